@@ -0,0 +1,801 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <list>
+#include <mutex>
+#include <shared_mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bi_ring.hpp"
+#include "bi_ring_unrolled.hpp"
+#include "bi_ring_buffer.hpp"
+#include "interleave_view.hpp"
+#include "concurrent_bi_ring.hpp"
+#include "ring_queue.hpp"
+#include "snapshot_bi_ring.hpp"
+
+#define loop_up(startpoint, endpoint) for(int i = startpoint; i < endpoint; i++)
+
+//time a callable and report throughput in millions of operations per second
+template <typename Callable>
+void measure(const std::string& name, double ops, Callable&& body) {
+	auto start = std::chrono::steady_clock::now();
+	body();
+	auto stop = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(stop - start).count();
+	std::cout << name << ": " << seconds * 1000 << " ms, "
+		  << ops / seconds / 1e6 << " Mops/s\n";
+}
+
+/*
+	NODE ALLOCATION
+*/
+
+void bench_push_remove() {
+	const int count = 2000000;
+	measure("bi_ring push", count, [&] {
+		bi_ring<int, int> ring;
+		loop_up(0, count) {
+			ring.push(i, i);
+		}
+	});
+	std::vector<std::pair<int, int>> items;
+	loop_up(0, count) {
+		items.emplace_back(i, i);
+	}
+	measure("bi_ring push from vector", count, [&] {
+		bi_ring<int, int> ring;
+		for(const std::pair<int, int>& item : items) {
+			ring.push(item.first, item.second);
+		}
+	});
+	measure("bi_ring range construction", count, [&] {
+		bi_ring<int, int> ring(items.begin(), items.end());
+	});
+	measure("bi_ring append in 1000 runs", count, [&] {
+		bi_ring<int, int> ring;
+		for(int i = 0; i < count; i += count / 1000) {
+			ring.append(items.begin() + i, items.begin() + i + count / 1000);
+		}
+	});
+	measure("bi_ring push + remove", 2.0 * count, [&] {
+		bi_ring<int, int> ring;
+		loop_up(0, count) {
+			ring.push(i, i);
+		}
+		bi_ring<int, int>::iterator itr(ring.begin());
+		while(itr.valid()) {
+			itr = ring.remove(itr);
+		}
+	});
+	measure("bi_ring churn", 2.0 * count, [&] {
+		bi_ring<int, int> ring;
+		loop_up(0, 1000) {
+			ring.push(i, i);
+		}
+		bi_ring<int, int>::iterator itr(ring.begin());
+		loop_up(0, count) {
+			itr = ring.insert_after(i, i, itr);
+			itr = ring.remove_before(itr);
+		}
+	});
+	measure("std::list push + pop", 2.0 * count, [&] {
+		std::list<std::pair<int, int>> list;
+		loop_up(0, count) {
+			list.emplace_back(i, i);
+		}
+		while(!list.empty()) {
+			list.pop_front();
+		}
+	});
+}
+
+void bench_concat() {
+	const int count = 1000000;
+	const int rounds = 100;
+	bi_ring<int, int> big;
+	loop_up(0, count) {
+		big.push(i, i);
+	}
+	measure("bi_ring += 1000 copied", rounds * 1000.0, [&] {
+		loop_up(0, rounds) {
+			bi_ring<int, int> part;
+			for(int j = 0; j < 1000; j++) {
+				part.push(j, j);
+			}
+			big += part;
+		}
+	});
+	measure("bi_ring += 1000 spliced", rounds * 1000.0, [&] {
+		loop_up(0, rounds) {
+			bi_ring<int, int> part;
+			for(int j = 0; j < 1000; j++) {
+				part.push(j, j);
+			}
+			big += std::move(part);
+		}
+	});
+	std::cout << "  (size " << big.size() << ")\n";
+}
+
+void bench_copy() {
+	const int count = 2000000;
+	bi_ring<int, int> source;
+	loop_up(0, count) {
+		source.push(i, i);
+	}
+	measure("bi_ring copy construct", count, [&] {
+		bi_ring<int, int> copy(source);
+	});
+	bi_ring<int, int> target(source);
+	target.clear_info(1);
+	measure("bi_ring copy assign, same size", count, [&] {
+		target = source;
+	});
+	bi_ring<int, int> smaller;
+	loop_up(0, count / 2) {
+		smaller.push(i, -i);
+	}
+	measure("bi_ring copy assign, half size", count, [&] {
+		smaller = source;
+	});
+}
+
+/*
+	TRAVERSAL
+*/
+
+template <typename Ring>
+void bench_ring_traversal(const std::string& name, const Ring& ring) {
+	long long sum = 0;
+	measure(name + " iterate", ring.size(), [&] {
+		for(typename Ring::const_iterator itr = ring.begin(); itr != ring.end(); ++itr) {
+			sum += itr.info();
+		}
+	});
+	Ring copy(ring);
+	bool same = false;
+	measure(name + " operator==", ring.size(), [&] {
+		same = (copy == ring);
+	});
+	measure(name + " get_info miss", ring.size(), [&] {
+		try {
+			sum += ring.get_info(-1);
+		}
+		catch(const std::invalid_argument&) {
+		}
+	});
+	measure(name + " clear_info", ring.size(), [&] {
+		copy.clear_info(0);
+	});
+	std::cout << "  (checksum " << sum + same << ")\n";
+}
+
+bi_ring<int, int> build_scattered(int count) {
+	//insert after pseudo-random earlier elements, so ring order differs from allocation order
+	bi_ring<int, int> ring(0, 0);
+	std::vector<bi_ring<int, int>::iterator> placed(1, ring.begin());
+	unsigned int seed = 1;
+	loop_up(1, count) {
+		seed = seed * 1103515245 + 12345;
+		placed.push_back(ring.insert_after(i, i, placed[(seed >> 8) % placed.size()]));
+	}
+	return ring;
+}
+
+void bench_traversal() {
+	const int count = 2000000;
+	bi_ring<int, int> linked;
+	bi_ring_unrolled<int, int> unrolled;
+	bi_ring_buffer<int, int> buffer;
+	loop_up(0, count) {
+		linked.push(i, i);
+		unrolled.push(i, i);
+		buffer.push(i, i);
+	}
+	bench_ring_traversal("bi_ring pushed", linked);
+	bench_ring_traversal("bi_ring scattered", build_scattered(count));
+	bench_ring_traversal("bi_ring_unrolled<16>", unrolled);
+	bench_ring_traversal("bi_ring_buffer", buffer);
+}
+
+//plain forward walk, the loop the iterator policy decides the cost of
+template <typename Ring>
+void bench_policy_walk(const std::string& name, const Ring& ring) {
+	long long sum = 0;
+	measure(name + " walk", ring.size(), [&] {
+		long long local = 0;
+		typename Ring::const_iterator last = ring.end();
+		for(typename Ring::const_iterator itr = ring.begin(); itr != last; ++itr) {
+			local += *itr;
+		}
+		sum += local;
+	});
+	std::cout << "  (checksum " << sum << ")\n";
+}
+
+void bench_policy() {
+	//run from both bench targets, the -unchecked one builds with BI_RING_UNCHECKED
+	const int count = 10000000;
+	std::string policy = iterator_checks::enabled ? " checked" : " unchecked";
+	bi_ring<int, int> linked;
+	bi_ring_unrolled<int, int> unrolled;
+	bi_ring_buffer<int, int> buffer;
+	loop_up(0, count) {
+		linked.push(i, i);
+		unrolled.push(i, i);
+		buffer.push(i, i);
+	}
+	bench_policy_walk("bi_ring" + policy, linked);
+	bench_policy_walk("bi_ring_unrolled<16>" + policy, unrolled);
+	bench_policy_walk("bi_ring_buffer" + policy, buffer);
+}
+
+//full-ring passes, serial and split over growing pools
+void bench_parallel() {
+	const int count = 10000000;
+	bi_ring<int, int> ring;
+	loop_up(0, count) {
+		ring.push(i, i);
+	}
+	bi_ring<int, int> copy(ring);
+	long long sum = 0;
+	auto odd = [](const int&, const int& info) { return info % 2 == 1; };
+	measure("bi_ring clear_info serial", count, [&] {
+		ring.clear_info(1);
+	});
+	copy.clear_info(1);
+	measure("bi_ring count_if serial", count, [&] {
+		sum += ring.count_if(odd);
+	});
+	measure("bi_ring operator== serial", count, [&] {
+		sum += ring == copy;
+	});
+	unsigned int hardware = std::max(1u, std::thread::hardware_concurrency());
+	for(unsigned int threads = 1; threads <= 2 * hardware && threads <= 64; threads *= 2) {
+		thread_pool workers(threads);
+		std::string suffix = " " + std::to_string(threads) + " threads";
+		//first pass also builds the checkpoint table
+		measure("bi_ring clear_info" + suffix, count, [&] {
+			ring.clear_info(workers, 1);
+		});
+		measure("bi_ring count_if" + suffix, count, [&] {
+			sum += ring.count_if(workers, odd);
+		});
+		measure("bi_ring equal" + suffix, count, [&] {
+			sum += ring.equal(workers, copy);
+		});
+		measure("bi_ring transform_info" + suffix, count, [&] {
+			ring.transform_info(workers, [](const int&, const int& info) { return info; });
+		});
+	}
+	std::cout << "  (checksum " << sum << ", " << hardware << " hardware threads)\n";
+}
+
+/*
+	ORDERING
+*/
+
+//ring of count elements under pseudo-random keys
+bi_ring<int, int> random_ring(int count, unsigned int seed = 17) {
+	bi_ring<int, int> ring;
+	loop_up(0, count) {
+		seed = seed * 1103515245 + 12345;
+		ring.push(static_cast<int>(seed >> 4), i);
+	}
+	return ring;
+}
+
+void bench_sort() {
+	for(int count : {1000000, 10000000}) {
+		std::string suffix = " " + std::to_string(count / 1000000) + "M";
+		bi_ring<int, int> ring = random_ring(count);
+		measure("bi_ring vector round-trip sort" + suffix, count, [&] {
+			std::vector<std::pair<int, int>> items;
+			items.reserve(ring.size());
+			for(bi_ring<int, int>::const_iterator itr = ring.begin(); itr != ring.end(); ++itr) {
+				items.emplace_back(itr.key(), itr.info());
+			}
+			std::stable_sort(items.begin(), items.end(), [](const auto& a, const auto& b) {
+				return a.first < b.first;
+			});
+			ring.purge();
+			for(const std::pair<int, int>& item : items) {
+				ring.push(item.first, item.second);
+			}
+		});
+		ring = random_ring(count);
+		measure("bi_ring sort" + suffix, count, [&] {
+			ring.sort();
+		});
+		std::list<std::pair<int, int>> list;
+		bi_ring<int, int> source = random_ring(count);
+		for(bi_ring<int, int>::const_iterator itr = source.begin(); itr != source.end(); ++itr) {
+			list.emplace_back(itr.key(), itr.info());
+		}
+		measure("std::list sort" + suffix, count, [&] {
+			list.sort([](const auto& a, const auto& b) { return a.first < b.first; });
+		});
+		//two sorted halves merged into one
+		bi_ring<int, int> first = random_ring(count / 2);
+		bi_ring<int, int> secnd = random_ring(count / 2, 29);
+		first.sort();
+		secnd.sort();
+		measure("bi_ring merge" + suffix, count, [&] {
+			first.merge(std::move(secnd));
+		});
+	}
+}
+
+/*
+	BULK REMOVAL
+*/
+
+void bench_erase() {
+	//a sweep dropping about 30% of the ring
+	const int count = 4000000;
+	auto expired = [](const int&, const int& info) { return info % 10 < 3; };
+	bi_ring<int, int> ring = random_ring(count);
+	measure("bi_ring remove loop 30%", count, [&] {
+		bi_ring<int, int>::iterator itr(ring.begin());
+		for(int i = 0; i < count; i++) {
+			itr = expired(itr.key(), itr.info()) ? ring.remove(itr) : std::next(itr);
+		}
+	});
+	std::cout << "  (left " << ring.size() << ")\n";
+	ring = random_ring(count);
+	measure("bi_ring remove_if 30%", count, [&] {
+		ring.remove_if(expired);
+	});
+	std::cout << "  (left " << ring.size() << ")\n";
+	ring = random_ring(count);
+	measure("bi_ring erase half", count / 2, [&] {
+		ring.erase(ring.begin(), ring.at(count / 2));
+	});
+}
+
+/*
+	TEXT OUTPUT
+*/
+
+//time writing a ring out as text and report throughput in megabytes per second
+template <typename Write>
+void measure_output(const std::string& name, Write&& write) {
+	std::ostringstream str;
+	auto start = std::chrono::steady_clock::now();
+	write(str);
+	auto stop = std::chrono::steady_clock::now();
+	double seconds = std::chrono::duration<double>(stop - start).count();
+	std::cout << name << ": " << seconds * 1000 << " ms, "
+		  << str.str().size() / seconds / 1e6 << " MB/s\n";
+}
+
+void bench_output() {
+	const int count = 5000000;
+	bi_ring<int, int> ring = random_ring(count);
+	measure_output("stream insertion per element", [&](std::ostream& str) {
+		for(bi_ring<int, int>::const_iterator itr = ring.begin(); itr != ring.end(); ++itr) {
+			str << '[' << itr.key() << "] " << itr.info() << std::endl;
+		}
+	});
+	measure_output("bi_ring operator<<", [&](std::ostream& str) {
+		str << ring;
+	});
+	bi_ring<double, std::string> mixed;
+	loop_up(0, count / 5) {
+		mixed.push(i * 0.37, "entry");
+	}
+	measure_output("bi_ring<double, string> operator<<", [&](std::ostream& str) {
+		str << mixed;
+	});
+	//print() goes to std::cout, point it at a string for the run
+	std::ostringstream captured;
+	std::streambuf* console = std::cout.rdbuf(captured.rdbuf());
+	auto start = std::chrono::steady_clock::now();
+	ring.print();
+	auto stop = std::chrono::steady_clock::now();
+	std::cout.rdbuf(console);
+	double seconds = std::chrono::duration<double>(stop - start).count();
+	std::cout << "bi_ring print: " << seconds * 1000 << " ms, "
+		  << captured.str().size() / seconds / 1e6 << " MB/s\n";
+}
+
+/*
+	SERIALIZATION
+*/
+
+void bench_serialize() {
+	const int count = 10000000;
+	bi_ring<int, int> ring = random_ring(count);
+	std::stringstream data;
+	measure("bi_ring save 10M", count, [&] {
+		ring.save(data);
+	});
+	bi_ring<int, int> loaded;
+	measure("bi_ring load 10M", count, [&] {
+		loaded.load(data);
+	});
+	std::cout << "  (" << data.str().size() / 1e6 << " MB, equal " << (loaded == ring) << ")\n";
+	std::stringstream text;
+	text << ring;
+	measure("bi_ring text parse 10M", count, [&] {
+		bi_ring<int, int> parsed;
+		char open;
+		char close;
+		int key;
+		int info;
+		while(text >> open >> key >> close >> info) {
+			parsed.push(key, info);
+		}
+	});
+}
+
+/*
+	INTERLEAVING
+*/
+
+void bench_interleave() {
+	const int count = 500000;
+	const unsigned int reps = 200000;
+	bi_ring<int, int> first;
+	bi_ring<int, int> secnd;
+	loop_up(0, count) {
+		first.push(i, i);
+		secnd.push(-i, i);
+	}
+	double ops = 7.0 * reps;
+	long long sum = 0;
+	measure("shuffle + walk", ops, [&] {
+		bi_ring<int, int> result = shuffle(first, 3, secnd, 4, reps);
+		bi_ring<int, int>::const_iterator itr(result);
+		for(unsigned int left = result.size(); left; left--, ++itr) {
+			sum += itr.info();
+		}
+	});
+	measure("interleave view walk", ops, [&] {
+		auto view = interleave(std::as_const(first), 3, std::as_const(secnd), 4, reps);
+		auto itr = view.begin();
+		for(unsigned int left = view.size(); left; left--, ++itr) {
+			sum += *itr;
+		}
+	});
+	measure("interleave materialize", ops, [&] {
+		sum += interleave(std::as_const(first), 3, std::as_const(secnd), 4, reps).materialize().size();
+	});
+	measure("interleave materialize_move", ops, [&] {
+		sum += interleave(first, 3, secnd, 4, reps).materialize_move().size();
+	});
+	std::cout << "  (checksum " << sum << ", left " << first.size() + secnd.size() << ")\n";
+}
+
+/*
+	CONCURRENCY
+*/
+
+//runs body(thread) on each of threads threads and waits for all of them
+template <typename Body>
+void run_threads(int threads, Body&& body) {
+	std::vector<std::thread> workers;
+	loop_up(0, threads) {
+		workers.emplace_back(body, i);
+	}
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+void bench_concurrent() {
+	//every thread churns its own stretch of a shared ring
+	const int total = 2000000;
+	for(int threads : {1, 2, 4, 8, 16, 32}) {
+		const int rounds = total / threads;
+		std::string suffix = " " + std::to_string(threads) + " threads";
+		measure("bi_ring + mutex churn" + suffix, 3.0 * total, [&] {
+			bi_ring<int, int> ring;
+			std::mutex guard;
+			run_threads(threads, [&](int id) {
+				bi_ring<int, int>::iterator anchor;
+				{
+					std::lock_guard<std::mutex> lock(guard);
+					anchor = ring.push(id, 0);
+				}
+				for(int j = 0; j < rounds; j++) {
+					std::lock_guard<std::mutex> lock(guard);
+					bi_ring<int, int>::iterator added = ring.insert_after(id, j, anchor);
+					anchor.info()++;
+					ring.remove(added);
+				}
+			});
+		});
+		measure("concurrent_bi_ring churn" + suffix, 3.0 * total, [&] {
+			concurrent_bi_ring<int, int> ring;
+			run_threads(threads, [&](int id) {
+				concurrent_bi_ring<int, int>::iterator anchor = ring.push(id, 0);
+				for(int j = 0; j < rounds; j++) {
+					concurrent_bi_ring<int, int>::iterator added = ring.insert_after(id, j, anchor);
+					ring.update(anchor, [](int& info) { info++; });
+					ring.remove(added);
+				}
+			});
+		});
+	}
+	std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)\n";
+}
+
+void bench_queue() {
+	//as many producers as consumers, every element passes through the queue once
+	const int total = 2000000;
+	for(int pairs : {1, 2, 4, 8, 16}) {
+		const int each = total / pairs;
+		std::string suffix = " " + std::to_string(pairs) + "+" + std::to_string(pairs) + " threads";
+		measure("bi_ring + mutex fifo" + suffix, 2.0 * total, [&] {
+			bi_ring<int, int> ring;
+			std::mutex guard;
+			run_threads(2 * pairs, [&](int id) {
+				for(int j = 0; j < each; ) {
+					std::lock_guard<std::mutex> lock(guard);
+					if(id < pairs) {
+						ring.push(id, j++);
+					}
+					else if(!ring.empty()) {
+						ring.remove(ring.begin());
+						j++;
+					}
+				}
+			});
+		});
+		measure("ring_queue fifo" + suffix, 2.0 * total, [&] {
+			ring_queue<int, int> queue;
+			run_threads(2 * pairs, [&](int id) {
+				int key = 0;
+				int info = 0;
+				for(int j = 0; j < each; ) {
+					if(id < pairs) {
+						queue.push(id, j++);
+					}
+					else if(queue.pop_front(key, info)) {
+						j++;
+					}
+				}
+			});
+		});
+	}
+	//contention only shows with threads on separate cores
+	std::cout << "  (" << std::thread::hardware_concurrency() << " hardware threads)\n";
+}
+
+void bench_snapshot() {
+	//95 lookups to 5 writes, over a ring of a thousand keys
+	const int total = 200000;
+	const int keys = 1000;
+	std::atomic<long long> sum(0);
+	for(int threads : {1, 2, 4, 8, 16}) {
+		const int each = total / threads;
+		std::string suffix = " " + std::to_string(threads) + " threads";
+		measure("bi_ring + mutex 95/5" + suffix, total, [&] {
+			bi_ring<int, int> ring;
+			loop_up(0, keys) {
+				ring.push(i, i);
+			}
+			std::mutex guard;
+			run_threads(threads, [&](int id) {
+				long long seen = 0;
+				for(int j = 0; j < each; j++) {
+					int key = (j * 7919 + id) % keys;
+					std::lock_guard<std::mutex> lock(guard);
+					if(j % 20) {
+						seen += ring.get_info(key);
+					}
+					else {
+						ring.remove(ring.find(key));
+						ring.push(key, j);
+					}
+				}
+				sum += seen;
+			});
+		});
+		measure("bi_ring + shared_mutex 95/5" + suffix, total, [&] {
+			bi_ring<int, int> ring;
+			loop_up(0, keys) {
+				ring.push(i, i);
+			}
+			std::shared_mutex guard;
+			run_threads(threads, [&](int id) {
+				long long seen = 0;
+				for(int j = 0; j < each; j++) {
+					int key = (j * 7919 + id) % keys;
+					if(j % 20) {
+						std::shared_lock<std::shared_mutex> lock(guard);
+						seen += ring.get_info(key);
+					}
+					else {
+						std::lock_guard<std::shared_mutex> lock(guard);
+						ring.remove(ring.find(key));
+						ring.push(key, j);
+					}
+				}
+				sum += seen;
+			});
+		});
+		measure("snapshot_bi_ring 95/5" + suffix, total, [&] {
+			snapshot_bi_ring<int, int> ring;
+			loop_up(0, keys) {
+				ring.push(i, i);
+			}
+			run_threads(threads, [&](int id) {
+				long long seen = 0;
+				for(int j = 0; j < each; j++) {
+					int key = (j * 7919 + id) % keys;
+					if(j % 20) {
+						seen += ring.get_info(key);
+					}
+					else {
+						//the new occurrence goes in first, so lookups always find the key
+						ring.push(key, j);
+						ring.remove(key);
+					}
+				}
+				sum += seen;
+			});
+		});
+	}
+	std::cout << "  (checksum " << sum << ")\n";
+}
+
+/*
+	KEY LOOKUP
+*/
+
+void bench_lookup() {
+	const int count = 200000;
+	const int queries = 2000;
+	bi_ring<int, int> plain;
+	loop_up(0, count) {
+		plain.push(i, i);
+	}
+	bi_ring<int, int> indexed(plain);
+	indexed.enable_index();
+	long long sum = 0;
+	measure("bi_ring get_info scan", queries, [&] {
+		loop_up(0, queries) {
+			sum += plain.get_info((i * 7919) % count);
+		}
+	});
+	measure("bi_ring get_info indexed", queries, [&] {
+		loop_up(0, queries) {
+			sum += indexed.get_info((i * 7919) % count);
+		}
+	});
+	measure("bi_ring push indexed", count, [&] {
+		bi_ring<int, int> ring;
+		ring.enable_index();
+		loop_up(0, count) {
+			ring.push(i, i);
+		}
+	});
+	//each insert repeats the key it goes behind, its later occurrences
+	//are found without walking the rest of the ring
+	bi_ring<int, int> copies(plain);
+	measure("bi_ring insert_after plain", queries, [&] {
+		bi_ring<int, int>::iterator itr = copies.begin();
+		loop_up(0, queries) {
+			itr = copies.insert_after(itr.key(), i, itr);
+			++itr;
+		}
+	});
+	measure("bi_ring insert_after indexed", queries, [&] {
+		bi_ring<int, int>::iterator itr = indexed.begin();
+		loop_up(0, queries) {
+			itr = indexed.insert_after(itr.key(), i, itr);
+			++itr;
+		}
+	});
+	std::cout << "  (checksum " << sum << ")\n";
+}
+
+/*
+	POSITIONAL ACCESS
+*/
+
+void bench_positions() {
+	const int count = 1000000;
+	const int jumps = 200;
+	bi_ring<int, int> plain;
+	loop_up(0, count) {
+		plain.push(i, i);
+	}
+	bi_ring<int, int> positioned(plain);
+	positioned.enable_positions();
+	long long sum = 0;
+	for(bi_ring<int, int>* ring : {&plain, &positioned}) {
+		std::string name = ring -> positioned() ? "bi_ring positioned" : "bi_ring plain";
+		measure(name + " advance", jumps, [&] {
+			bi_ring<int, int>::const_iterator itr(*ring);
+			loop_up(0, jumps) {
+				itr = ring -> advance(itr, 1 + (i * 7919) % (count / 3));
+				sum += itr.key();
+			}
+		});
+		measure(name + " at + position_of", jumps, [&] {
+			loop_up(0, jumps) {
+				sum += ring -> position_of(ring -> at((i * 7919) % count));
+			}
+		});
+	}
+	measure("bi_ring push positioned", count, [&] {
+		bi_ring<int, int> ring;
+		ring.enable_positions();
+		loop_up(0, count) {
+			ring.push(i, i);
+		}
+	});
+	std::cout << "  (checksum " << sum << ")\n";
+}
+
+/*
+	KEY SCAN
+*/
+
+template <typename Key>
+void bench_key_scan(const std::string& name) {
+	const int count = 4000000;
+	bi_ring_buffer<Key, int> buffer;
+	bi_ring_unrolled<Key, int> unrolled;
+	loop_up(0, count) {
+		buffer.push(static_cast<Key>(i % 1000), i);
+		unrolled.push(static_cast<Key>(i % 1000), i);
+	}
+	unsigned long long sum = 0;
+	scan_isa best = key_scan_isa();
+	const char* isa_names[] = {"scalar", "sse4", "avx2"};
+	for(scan_isa isa : {scan_isa::scalar, scan_isa::sse4, scan_isa::avx2}) {
+		if(isa > best) {
+			break;
+		}
+		key_scan_isa() = isa;
+		std::string suffix = std::string(" count ") + isa_names[static_cast<int>(isa)];
+		measure("bi_ring_buffer<" + name + ">" + suffix, count, [&] {
+			sum += buffer.count(static_cast<Key>(999));
+		});
+		measure("bi_ring_unrolled<" + name + ">" + suffix, count, [&] {
+			sum += unrolled.count(static_cast<Key>(999));
+		});
+	}
+	key_scan_isa() = best;
+	std::cout << "  (checksum " << sum << ")\n";
+}
+
+void bench_scan() {
+	bench_key_scan<int>("int");
+	bench_key_scan<std::uint64_t>("uint64_t");
+	bench_key_scan<double>("double");
+}
+
+int main(int argc, char** argv) {
+	//optionally run a single group picked by name
+	const char* only = argc > 1 ? argv[1] : nullptr;
+	if(!only || !std::strcmp(only, "alloc")) bench_push_remove();
+	if(!only || !std::strcmp(only, "concat")) bench_concat();
+	if(!only || !std::strcmp(only, "copy")) bench_copy();
+	if(!only || !std::strcmp(only, "parallel")) bench_parallel();
+	if(!only || !std::strcmp(only, "sort")) bench_sort();
+	if(!only || !std::strcmp(only, "erase")) bench_erase();
+	if(!only || !std::strcmp(only, "output")) bench_output();
+	if(!only || !std::strcmp(only, "serialize")) bench_serialize();
+	if(!only || !std::strcmp(only, "interleave")) bench_interleave();
+	if(!only || !std::strcmp(only, "traversal")) bench_traversal();
+	if(!only || !std::strcmp(only, "policy")) bench_policy();
+	if(!only || !std::strcmp(only, "concurrent")) bench_concurrent();
+	if(!only || !std::strcmp(only, "queue")) bench_queue();
+	if(!only || !std::strcmp(only, "snapshot")) bench_snapshot();
+	if(!only || !std::strcmp(only, "lookup")) bench_lookup();
+	if(!only || !std::strcmp(only, "scan")) bench_scan();
+	if(!only || !std::strcmp(only, "positions")) bench_positions();
+	return 0;
+}
@@ -8,70 +8,245 @@
 #define SEQUENCE_HPP
 
 //dependencies
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <set>
 #include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "node_pool.hpp"
+#include "position_index.hpp"
+#include "ring_codec.hpp"
+#include "text_output.hpp"
+#include "thread_pool.hpp"
 
 const char* nulldef_exc = "Invalid iterator dereferencing attempt.";
 const char* itrinvl_exc = "Operation forbidden for invalid iterator.";
 
-template <typename Key, typename Info>
+//iterator checking policies, checked steps and accessors throw on an invalid
+//iterator, unchecked ones trust the caller and drop the null tests, a linked
+//step still compares against the ring's first element to count laps
+struct checked_iterators {
+	static constexpr bool enabled = true;
+};
+struct unchecked_iterators {
+	static constexpr bool enabled = false;
+};
+//picked for the whole program, define BI_RING_UNCHECKED before the first include
+#ifdef BI_RING_UNCHECKED
+using iterator_checks = unchecked_iterators;
+#else
+using iterator_checks = checked_iterators;
+#endif
+
+//detects key types usable with the hash index
+template <typename T, typename = void>
+struct is_hashable : std::false_type {};
+template <typename T>
+struct is_hashable<T, std::void_t<decltype(std::hash<T>()(std::declval<const T&>()))>>
+	: std::true_type {};
+
+template <typename Key, typename Info,
+	  typename Alloc = std::allocator<std::pair<const Key, Info>>>
 class bi_ring;
-template <typename Key, typename Info>
-std::ostream& operator<<(std::ostream& str, const bi_ring<Key,Info>& seq);
+template <typename Key, typename Info, typename Alloc>
+std::ostream& operator<<(std::ostream& str, const bi_ring<Key, Info, Alloc>& seq);
 
-template <typename Key, typename Info>
+template <typename Key, typename Info, typename Alloc>
 class bi_ring {
 public:
+	using allocator_type = Alloc;
+
 	//(de)constructors
 	bi_ring(); //DONE
-	bi_ring(const Key& key, const Info& inf); //DONE
-	bi_ring(const bi_ring<Key, Info>& src);   //DONE
-	bi_ring(bi_ring&& src);
+	explicit bi_ring(const Alloc& alloc); //DONE
+	bi_ring(const Key& key, const Info& inf,
+		const Alloc& alloc = Alloc()); //DONE
+	//elements are pairs of key and info
+	template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+	bi_ring(InputIt first, InputIt last, const Alloc& alloc = Alloc()); //DONE
+	bi_ring(std::initializer_list<std::pair<Key, Info>> items,
+		const Alloc& alloc = Alloc()); //DONE
+	bi_ring(const bi_ring<Key, Info, Alloc>& src);   //DONE
+	bi_ring(const bi_ring<Key, Info, Alloc>& src, const Alloc& alloc); //DONE
+	bi_ring(bi_ring&& src); //DONE
+	bi_ring(bi_ring&& src, const Alloc& alloc); //DONE
 	~bi_ring(); //DONE
 	
 	//operators
-	bool operator==(const bi_ring<Key, Info>& cmp) const; //DONE
-	bool operator!=(const bi_ring<Key, Info>& cmp) const; //DONE
-	bi_ring<Key, Info>& operator=(const bi_ring<Key, Info>& src); //DONE
-	bi_ring<Key, Info>& operator=(bi_ring<Key, Info>&& src);
-	bi_ring<Key, Info> operator+(const bi_ring<Key, Info>& src) const; //DONE
-	bi_ring<Key, Info>& operator+=(const bi_ring<Key, Info>& src); //DONE
-	friend std::ostream& operator<< <Key, Info>(std::ostream& str,
-					 	    const bi_ring<Key, Info>& seq); //DONE
+	bool operator==(const bi_ring<Key, Info, Alloc>& cmp) const; //DONE
+	bool operator!=(const bi_ring<Key, Info, Alloc>& cmp) const; //DONE
+	bi_ring<Key, Info, Alloc>& operator=(const bi_ring<Key, Info, Alloc>& src); //DONE
+	bi_ring<Key, Info, Alloc>& operator=(bi_ring<Key, Info, Alloc>&& src); //DONE
+	bi_ring<Key, Info, Alloc> operator+(const bi_ring<Key, Info, Alloc>& src) const &; //DONE
+	bi_ring<Key, Info, Alloc> operator+(const bi_ring<Key, Info, Alloc>& src) &&; //DONE
+	bi_ring<Key, Info, Alloc> operator+(bi_ring<Key, Info, Alloc>&& src) const &; //DONE
+	bi_ring<Key, Info, Alloc> operator+(bi_ring<Key, Info, Alloc>&& src) &&; //DONE
+	bi_ring<Key, Info, Alloc>& operator+=(const bi_ring<Key, Info, Alloc>& src); //DONE
+	bi_ring<Key, Info, Alloc>& operator+=(bi_ring<Key, Info, Alloc>&& src); //DONE
+	friend std::ostream& operator<< <Key, Info, Alloc>(std::ostream& str,
+					 	    const bi_ring<Key, Info, Alloc>& seq); //DONE
 					 	     	    
-	//iterators
+	//iterators, each counts a lap whenever it steps onto the element that
+	//is first at the time; they reach the ring through a handle handed over
+	//with the elements, so they stay valid across swap() and moves and still
+	//reach end() after another element becomes first; an iterator to an
+	//element gone over to another ring (split, splice) still dereferences,
+	//but only new ones reach end() there
 	class const_iterator; //DONE
 	class iterator; //DONE
 	
 	//insertion methods
 	iterator push(const Key& key, const Info& inf); //DONE
+	iterator push(Key key, Info&& inf); //DONE
 	iterator insert_after(const Key& key,  const Info& inf, 
 			      iterator what); //DONE
+	iterator insert_after(Key key, Info&& inf,
+			      iterator what); //DONE
 	iterator insert_before(const Key& key,  const Info& inf, 
 			       iterator what); //DONE
+	iterator insert_before(Key key, Info&& inf,
+			       iterator what); //DONE
 	bool replace(const Key& key,   const Info& inf, 
 		     iterator what); //DONE
+	bool replace(Key key, Info&& inf,
+		     iterator what); //DONE
+
+	//range insertion, nodes of a sized range are allocated at once
+	//and linked into the ring with a single splice
+	template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+	void append(InputIt first, InputIt last); //DONE
+	//gives the last element inserted, pos for an empty range
+	template <typename InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+	iterator insert_after(iterator pos, InputIt first, InputIt last); //DONE
+
+	//in-place insertion, key from key, info constructed from args
+	template <typename K, typename... Args>
+	iterator emplace(K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_after(iterator what, K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_before(iterator what, K&& key, Args&&... args); //DONE
+
+	//relinking insertion before pos, payloads are only moved for unequal allocators;
+	//a range keeps the blocks its nodes came from alive until both rings let go
+	//of them, a whole ring hands its blocks over and other keeps none
+	void splice(iterator pos, bi_ring<Key, Info, Alloc>&& other); //DONE
+	void splice(iterator pos, bi_ring<Key, Info, Alloc>& other,
+		    iterator first, iterator last); //DONE
 	
 	//removal methods
 	bool purge(); //DONE
 	iterator remove_after(iterator what); //DONE
 	iterator remove_before(iterator what); //DONE
 	iterator remove(iterator what); //DONE
+	//bulk removal in a single pass, counts of removed elements returned
+	template <typename Predicate>
+	unsigned int remove_if(Predicate pred); //DONE
+	unsigned int remove_key(const Key& key); //DONE
+	//removes first up to last, last excluded, first == last a lap apart for all
+	iterator erase(iterator first, iterator last); //DONE
 	
 	//getter methods
 	bool empty() const; //DONE
 	unsigned int size() const; //DONE
+	Alloc get_allocator() const; //DONE
 	void print() const; //DONE
-	Info get_info(const Key& key, int n_key = 1) const; //DONE
+	const Info& get_info(const Key& key, int n_key = 1) const; //DONE
+	const_iterator find(const Key& key, int n_key = 1) const; //DONE
+	iterator find(const Key& key, int n_key = 1); //DONE
+	unsigned int count(const Key& key) const; //DONE
 	const_iterator begin() const; //DONE
+	//past the last element, begin() one lap later
 	const_iterator end() const; //DONE
 	
+	//bulk methods, fn(key, info) sees every element once in ring order
+	template <typename Function>
+	void for_each(Function fn); //DONE
+	//info becomes fn(key, info)
+	template <typename Function>
+	void transform_info(Function fn); //DONE
+	template <typename Predicate>
+	unsigned int count_if(Predicate pred) const; //DONE
+
+	//parallel bulk methods, segments of the ring run on workers at once, so
+	//fn has to be safe to call concurrently for distinct elements
+	template <typename Function>
+	void for_each(thread_pool& workers, Function fn); //DONE
+	template <typename Function>
+	void transform_info(thread_pool& workers, Function fn); //DONE
+	template <typename Predicate>
+	unsigned int count_if(thread_pool& workers, Predicate pred) const; //DONE
+	bool clear_info(thread_pool& workers, const Info& filler); //DONE
+	bool equal(thread_pool& workers, const bi_ring<Key, Info, Alloc>& cmp) const; //DONE
+
 	//utility methods
 	bool clear_info(const Info& filler); //DONE
 	bool swap(iterator what,
 		  iterator dest); //DONE
+	//exchanges ring positions of the two nodes, iterators follow their payloads
+	bool swap_nodes(iterator what, iterator dest); //DONE
+	void swap(bi_ring<Key, Info, Alloc>& other); //DONE
+
+	//ordering methods, stable merges relinking the nodes, keys compared by comp
+	void sort(); //DONE
+	template <typename Compare>
+	void sort(Compare comp); //DONE
+	//other has to be sorted by the same order already, it is left empty
+	void merge(bi_ring<Key, Info, Alloc>&& other); //DONE
+	template <typename Compare>
+	void merge(bi_ring<Key, Info, Alloc>&& other, Compare comp); //DONE
+
+	//reshaping methods, relinking only
+	//at and all behind it up to the end of the ring move to the returned ring,
+	//unfiled one by one in index and position mode; the returned ring shares
+	//only the blocks its nodes live in, allocating nothing while they fit in
+	//eight, the whole ring hands over its pool
+	bi_ring<Key, Info, Alloc> split(iterator at); //DONE
+	//what becomes the first element, O(1), O(log n) in position mode
+	void rotate_to(iterator what); //DONE
+	//first element stays, the rest follows in reverse, filed again in index
+	//and position mode
+	void reverse(); //DONE
+
+	//index methods
+	//keys changed through iterator::key() bypass the index, use replace
+	//in index mode insertions, removals, replace and swap take O(log n log k)
+	//more for k occurrences of the key, get_info and find(key, n) take
+	//O(log n log k + n), count O(1); rotate_to keeps the index as it is,
+	//sort, merge, reverse and assignment file every element again
+	void enable_index(); //DONE
+	void disable_index(); //DONE
+	bool indexed() const; //DONE
+
+	//position methods
+	//O(log n) in position mode, walking the ring otherwise
+	void enable_positions(); //DONE
+	void disable_positions(); //DONE
+	bool positioned() const; //DONE
+	const_iterator at(unsigned int pos) const; //DONE
+	unsigned int position_of(const_iterator what) const; //DONE
+	//result lies on the first lap
+	const_iterator advance(const_iterator what, int steps) const; //DONE
+
+	//serialization methods, binary in native byte order, types encoded by ring_codec
+	void save(std::ostream& str) const; //DONE
+	//replaces the contents, kept as they were when the data is rejected
+	void load(std::istream& str); //DONE
 	
 private:
+	using alloc_traits = std::allocator_traits<Alloc>;
 	//storage members
 	unsigned int length;
 	struct Element {
@@ -79,25 +254,114 @@ private:
 		Info info;
 		Element* next;
 		Element* prev;
+		template <typename K, typename... Args>
+		Element(Element* nxt, Element* prv, K&& k, Args&&... args); //DONE
 		bool operator==(const Element& cmp) const; //DONE
 		bool operator!=(const Element& cmp) const; //DONE
 	};
 	Element* any;
+	node_pool<Element, Alloc> pool;
+	//handle iterators reach the ring through, swap() and moves hand it
+	//over together with the elements
+	struct Owner {
+		const bi_ring<Key, Info, Alloc>* ring;
+	};
+	//made on first use, so empty rings and split() allocate nothing
+	mutable std::atomic<Owner*> owner{nullptr};
+	//orders elements by their rank, which only insertions and removals change,
+	//searches by a rank looked up once compare it to elements directly
+	struct ByRank {
+		using is_transparent = void;
+		const position_index<Element*>* ranks;
+		bool operator()(Element* first, Element* secnd) const {
+			return ranks -> position_of(first) < ranks -> position_of(secnd);
+		}
+		bool operator()(Element* item, unsigned int rank) const {
+			return ranks -> position_of(item) < rank;
+		}
+		bool operator()(unsigned int rank, Element* item) const {
+			return rank < ranks -> position_of(item);
+		}
+	};
+	//key to occurrences, only kept in index mode; elements are ranked in ring
+	//order by a position index of the index's own that is never rotated, so
+	//the occurrences of a key stay sorted whichever element comes first
+	struct Index {
+		position_index<Element*> ranks;
+		std::conditional_t<is_hashable<Key>::value,
+				   std::unordered_map<Key, std::set<Element*, ByRank>>,
+				   std::nullptr_t> occurrences;
+	};
+	std::unique_ptr<Index> lookup;
+	//ring positions of elements, only kept in position mode
+	std::unique_ptr<position_index<Element*>> order;
+	//bumped by every change to the links, tells stale checkpoints apart
+	unsigned long long revision = 0;
+	//starts of equal segments for parallel passes, built on first use and
+	//only ever replaced whole, atomically, so concurrent const passes each
+	//keep walking the set they loaded
+	struct Checkpoints {
+		unsigned long long revision;
+		std::vector<Element*> starts;
+	};
+	mutable std::shared_ptr<const Checkpoints> checkpoints;
+	//sorted chain linked forward, first to last, while sorting and merging
+	struct Run {
+		Element* first;
+		Element* last;
+	};
+	static constexpr unsigned int min_segment = 4096;
 	//helper methods
 	Element* _find(const Key& key, int n_key = 1) const; //DONE
-	bool _clone(const bi_ring<Key, Info>& src); //DONE
+	bool _clone(const bi_ring<Key, Info, Alloc>& src); //DONE
+	void _take(bi_ring<Key, Info, Alloc>& src); //DONE
+	void _trade_owner(bi_ring<Key, Info, Alloc>& other); //DONE
+	const Owner* _owner() const; //DONE
+	template <typename... Args>
+	Element* _create(Element* next, Element* prev, Args&&... args); //DONE
+	void _destroy(Element* item); //DONE
+	void _erase(Element* item); //DONE
+	template <typename InputIt>
+	Element* _insert_range(Element* pos, InputIt first, InputIt last); //DONE
+	void _free_chain(Element* first, Element* last); //DONE
+	void _index_insert(Element* item); //DONE
+	void _index_erase(Element* item); //DONE
+	void _index_file(Element* item); //DONE
+	void _index_unfile(Element* item); //DONE
+	void _index_clear(); //DONE
+	void _order_insert(Element* item); //DONE
+	void _order_erase(Element* item); //DONE
+	void _link(Element* pos, Element* first, Element* tail, unsigned int count); //DONE
+	void _move_range(Element* pos, bi_ring<Key, Info, Alloc>& other,
+			 Element* first, Element* last); //DONE
+	template <typename Compare>
+	static void _merge(Run& into, Run other, Compare& comp); //DONE
+	static Element* _relink(Element* first); //DONE
+	void _close(Element* first, Element* last); //DONE
+	void _refile(); //DONE
+	unsigned int _segment_count(const thread_pool* workers) const; //DONE
+	unsigned int _bound(unsigned int segment, unsigned int segments) const; //DONE
+	std::shared_ptr<const Checkpoints> _checkpoints(unsigned int segments) const; //DONE
+	template <typename Visit>
+	void _run_segments(thread_pool* workers, unsigned int segments, Visit visit) const; //DONE
 };
 
-template <typename Key, typename Info>
-class bi_ring<Key, Info>::const_iterator {
+template <typename Key, typename Info, typename Alloc>
+class bi_ring<Key, Info, Alloc>::const_iterator {
 
-friend bi_ring<Key, Info>;
+friend bi_ring<Key, Info, Alloc>;
 
 public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = Info;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Info*;
+	using reference = const Info&;
+
 	const_iterator(); //DONE
-	const_iterator(const bi_ring<Key, Info>& of); //DONE
+	const_iterator(const bi_ring<Key, Info, Alloc>& of); //DONE
 	const_iterator(const const_iterator& src); //DONE
-	const_iterator(const bi_ring<Key, Info>& of,
+	const_iterator(const bi_ring<Key, Info, Alloc>& of,
 		       int key, int n_key = 1); //DONE
 	
 	const_iterator& operator=(const const_iterator& src); //DONE
@@ -105,28 +369,39 @@ public:
 	const_iterator operator++(int ops); //DONE
 	const_iterator& operator--();   //DONE
 	const_iterator operator--(int ops); //DONE
-	Info operator*() const;   //DONE
+	const Info& operator*() const;   //DONE
 	bool operator==(const const_iterator& itr) const; //DONE
 	bool operator!=(const const_iterator& itr) const; //DONE
 	
 	//custom getters
-	Key key() const; //DONE
-	Info info() const; //DONE
+	const Key& key() const; //DONE
+	const Info& info() const; //DONE
 	bool valid() const; //DONE
 private:
+	//handle of the ring the iterator walks
+	const Owner* owner;
 	Element* current;
-	const_iterator(Element* at); //DONE
+	//times the first element was passed going forward, tells end() apart from begin()
+	int lap;
+	const_iterator(const bi_ring<Key, Info, Alloc>* of, Element* at, int laps = 0); //DONE
 };
 
-template <typename Key, typename Info>
-class bi_ring<Key, Info>::iterator : public bi_ring<Key, Info>::const_iterator {
+template <typename Key, typename Info, typename Alloc>
+class bi_ring<Key, Info, Alloc>::iterator : public bi_ring<Key, Info, Alloc>::const_iterator {
 
-friend bi_ring<Key, Info>;
+friend bi_ring<Key, Info, Alloc>;
 
 public:
+	using pointer = Info*;
+	using reference = Info&;
+
 	iterator(const const_iterator& src); //DONE
 	using const_iterator::const_iterator;
 	
+	iterator& operator++();   //DONE
+	iterator operator++(int ops); //DONE
+	iterator& operator--();   //DONE
+	iterator operator--(int ops); //DONE
 	Info& operator*(); //DONE
 	
 	//custom getters
@@ -135,17 +410,29 @@ public:
 	
 private:
 	//insertion methods
-	iterator insert_after(const Key& key, const Info& inf); //DONE
-	iterator insert_before(const Key& key, const Info& inf); //DONE
+	template <typename... Args>
+	iterator insert_after(bi_ring<Key, Info, Alloc>& parent, Args&&... args); //DONE
+	template <typename... Args>
+	iterator insert_before(bi_ring<Key, Info, Alloc>& parent, Args&&... args); //DONE
 	//deletion methods
-	iterator remove(bi_ring<Key, Info>& parent); //DONE
+	iterator remove(bi_ring<Key, Info, Alloc>& parent); //DONE
 };
 
-template <typename Key, typename Info>
-bi_ring<Key, Info> shuffle(const bi_ring<Key, Info>& first, unsigned int fcnt,
-			   const bi_ring<Key, Info>& secnd, unsigned int scnt,
+template <typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> shuffle(const bi_ring<Key, Info, Alloc>& first, unsigned int fcnt,
+			   const bi_ring<Key, Info, Alloc>& secnd, unsigned int scnt,
 			   unsigned int reps); //DONE
 
+template <typename Key, typename Info, typename Alloc>
+void swap(bi_ring<Key, Info, Alloc>& first, bi_ring<Key, Info, Alloc>& secnd); //DONE
+
+//ring backed by a memory resource, e.g. a request-scoped monotonic buffer
+namespace pmr {
+	template <typename Key, typename Info>
+	using bi_ring = ::bi_ring<Key, Info,
+		std::pmr::polymorphic_allocator<std::pair<const Key, Info>>>;
+}
+
 #include "bi_ring_impl.hpp"
 
 #endif
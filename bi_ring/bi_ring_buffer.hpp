@@ -0,0 +1,223 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef BUFFER_SEQUENCE_HPP
+#define BUFFER_SEQUENCE_HPP
+
+//dependencies
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+#include "bi_ring.hpp"
+#include "key_scan.hpp"
+#include "text_output.hpp"
+
+/*
+	Bi-directional ring kept in a growable circular buffer.
+	Keys and infos live in two separate cache-line aligned arrays
+	of power of two capacity, so bulk passes run over at most two
+	contiguous spans each. push and removal at either end are
+	amortized O(1), positional access is O(1), while inserting or
+	removing in the middle shifts the shorter side of the ring.
+	Unlike bi_ring there is no Alloc parameter, both arrays come from
+	aligned operator new. Growing copies elements whose move may throw,
+	where they can be copied, so a failed growth leaves the ring as it was.
+*/
+template <typename Key, typename Info>
+class bi_ring_buffer;
+template <typename Key, typename Info>
+std::ostream& operator<<(std::ostream& str, const bi_ring_buffer<Key, Info>& seq);
+
+template <typename Key, typename Info>
+class bi_ring_buffer {
+public:
+	//(de)constructors
+	bi_ring_buffer(); //DONE
+	bi_ring_buffer(const Key& key, const Info& inf); //DONE
+	bi_ring_buffer(const bi_ring_buffer<Key, Info>& src); //DONE
+	bi_ring_buffer(bi_ring_buffer<Key, Info>&& src); //DONE
+	~bi_ring_buffer(); //DONE
+
+	//operators
+	bool operator==(const bi_ring_buffer<Key, Info>& cmp) const; //DONE
+	bool operator!=(const bi_ring_buffer<Key, Info>& cmp) const; //DONE
+	bi_ring_buffer<Key, Info>& operator=(const bi_ring_buffer<Key, Info>& src); //DONE
+	bi_ring_buffer<Key, Info>& operator=(bi_ring_buffer<Key, Info>&& src); //DONE
+	bi_ring_buffer<Key, Info> operator+(const bi_ring_buffer<Key, Info>& src) const &; //DONE
+	bi_ring_buffer<Key, Info> operator+(const bi_ring_buffer<Key, Info>& src) &&; //DONE
+	bi_ring_buffer<Key, Info> operator+(bi_ring_buffer<Key, Info>&& src) const &; //DONE
+	bi_ring_buffer<Key, Info> operator+(bi_ring_buffer<Key, Info>&& src) &&; //DONE
+	bi_ring_buffer<Key, Info>& operator+=(const bi_ring_buffer<Key, Info>& src); //DONE
+	bi_ring_buffer<Key, Info>& operator+=(bi_ring_buffer<Key, Info>&& src); //DONE
+	friend std::ostream& operator<< <Key, Info>(std::ostream& str,
+						    const bi_ring_buffer<Key, Info>& seq); //DONE
+
+	//iterators, laps counted as for bi_ring, stay valid across swap() and moves
+	class const_iterator; //DONE
+	class iterator; //DONE
+
+	//insertion methods
+	iterator push(const Key& key, const Info& inf); //DONE
+	iterator push(Key key, Info&& inf); //DONE
+	iterator insert_after(const Key& key, const Info& inf,
+			      iterator what); //DONE
+	iterator insert_after(Key key, Info&& inf,
+			      iterator what); //DONE
+	iterator insert_before(const Key& key, const Info& inf,
+			       iterator what); //DONE
+	iterator insert_before(Key key, Info&& inf,
+			       iterator what); //DONE
+	bool replace(const Key& key, const Info& inf,
+		     iterator what); //DONE
+	bool replace(Key key, Info&& inf,
+		     iterator what); //DONE
+
+	//in-place insertion, key from key, info constructed from args
+	template <typename K, typename... Args>
+	iterator emplace(K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_after(iterator what, K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_before(iterator what, K&& key, Args&&... args); //DONE
+
+	//removal methods
+	bool purge(); //DONE
+	iterator remove_after(iterator what); //DONE
+	iterator remove_before(iterator what); //DONE
+	iterator remove(iterator what); //DONE
+
+	//getter methods
+	bool empty() const; //DONE
+	unsigned int size() const; //DONE
+	unsigned int capacity() const; //DONE
+	void print() const; //DONE
+	const Info& get_info(const Key& key, int n_key = 1) const; //DONE
+	const_iterator find(const Key& key, int n_key = 1) const; //DONE
+	iterator find(const Key& key, int n_key = 1); //DONE
+	unsigned int count(const Key& key) const; //DONE
+	const_iterator begin() const; //DONE
+	//past the last element, begin() one lap later
+	const_iterator end() const; //DONE
+	const_iterator at(unsigned int pos) const; //DONE
+
+	//utility methods
+	bool clear_info(const Info& filler); //DONE
+	bool swap(iterator what,
+		  iterator dest); //DONE
+	void swap(bi_ring_buffer<Key, Info>& other); //DONE
+	void reserve(unsigned int count); //DONE
+
+private:
+	static constexpr std::size_t line_size = 64;
+	//storage members
+	unsigned int length;
+	unsigned int head;
+	unsigned int slots;
+	Key* keys;
+	Info* infos;
+	//handle iterators reach the ring through, swap() and moves hand it
+	//over together with the elements
+	struct Owner {
+		bi_ring_buffer<Key, Info>* ring;
+	};
+	//made on first use, so empty rings allocate nothing
+	mutable std::atomic<Owner*> owner{nullptr};
+	//helper methods
+	unsigned int _slot(unsigned int pos) const; //DONE
+	unsigned int _find(const Key& key, int n_key = 1) const; //DONE
+	bool _clone(const bi_ring_buffer<Key, Info>& src); //DONE
+	void _trade_owner(bi_ring_buffer<Key, Info>& other); //DONE
+	const Owner* _owner() const; //DONE
+	void _relocate(unsigned int from, unsigned int to); //DONE
+	void _grow(unsigned int count); //DONE
+	void _release(); //DONE
+	template <typename K, typename... Args>
+	iterator _insert(unsigned int pos, K&& key, Args&&... args); //DONE
+	iterator _erase(unsigned int pos); //DONE
+};
+
+template <typename Key, typename Info>
+class bi_ring_buffer<Key, Info>::const_iterator {
+
+friend bi_ring_buffer<Key, Info>;
+
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = Info;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Info*;
+	using reference = const Info&;
+
+	const_iterator(); //DONE
+	const_iterator(const bi_ring_buffer<Key, Info>& of); //DONE
+	const_iterator(const const_iterator& src); //DONE
+	const_iterator(const bi_ring_buffer<Key, Info>& of,
+		       const Key& key, int n_key = 1); //DONE
+
+	const_iterator& operator=(const const_iterator& src); //DONE
+	const_iterator& operator++();   //DONE
+	const_iterator operator++(int ops); //DONE
+	const_iterator& operator--();   //DONE
+	const_iterator operator--(int ops); //DONE
+	const Info& operator*() const;   //DONE
+	bool operator==(const const_iterator& itr) const; //DONE
+	bool operator!=(const const_iterator& itr) const; //DONE
+
+	//custom getters
+	const Key& key() const; //DONE
+	const Info& info() const; //DONE
+	bool valid() const; //DONE
+	unsigned int position() const; //DONE
+private:
+	//handle of the ring the iterator walks
+	const Owner* owner;
+	unsigned int pos;
+	//times position 0 was passed going forward, tells end() apart from begin()
+	int lap;
+	const_iterator(const bi_ring_buffer<Key, Info>* of, unsigned int at, int laps = 0); //DONE
+};
+
+template <typename Key, typename Info>
+class bi_ring_buffer<Key, Info>::iterator
+	: public bi_ring_buffer<Key, Info>::const_iterator {
+
+friend bi_ring_buffer<Key, Info>;
+
+public:
+	using pointer = Info*;
+	using reference = Info&;
+
+	iterator(const const_iterator& src); //DONE
+	using const_iterator::const_iterator;
+
+	iterator& operator++();   //DONE
+	iterator operator++(int ops); //DONE
+	iterator& operator--();   //DONE
+	iterator operator--(int ops); //DONE
+	Info& operator*(); //DONE
+
+	//custom getters
+	Key& key(); //DONE
+	Info& info(); //DONE
+};
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> shuffle(const bi_ring_buffer<Key, Info>& first, unsigned int fcnt,
+				  const bi_ring_buffer<Key, Info>& secnd, unsigned int scnt,
+				  unsigned int reps); //DONE
+
+template <typename Key, typename Info>
+void swap(bi_ring_buffer<Key, Info>& first, bi_ring_buffer<Key, Info>& secnd); //DONE
+
+#include "bi_ring_buffer_impl.hpp"
+
+#endif
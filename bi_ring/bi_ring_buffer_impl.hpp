@@ -0,0 +1,939 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::bi_ring_buffer() {
+	length = 0;
+	head = 0;
+	slots = 0;
+	keys = nullptr;
+	infos = nullptr;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::bi_ring_buffer(const Key& key, const Info& inf) : bi_ring_buffer() {
+	//push initial first element
+	push(key, inf);
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::bi_ring_buffer(const bi_ring_buffer<Key, Info>& src) : bi_ring_buffer() {
+	//run the clone helper on this object
+	_clone(src);
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::bi_ring_buffer(bi_ring_buffer<Key, Info>&& src) : bi_ring_buffer() {
+	//move src content ownership
+	std::swap(length, src.length);
+	std::swap(head, src.head);
+	std::swap(slots, src.slots);
+	std::swap(keys, src.keys);
+	std::swap(infos, src.infos);
+	_trade_owner(src);
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::~bi_ring_buffer() {
+	_release();
+	delete owner.load();
+}
+
+/*
+	OPERATORS
+*/
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::operator==(const bi_ring_buffer<Key, Info>& cmp) const {
+	//check for comparison to self
+	if(this == &cmp) {
+		return true;
+	}
+	//check lengths first
+	if(size() != cmp.size()) {
+		return false;
+	}
+	//compare runs that are contiguous in both buffers
+	unsigned int pos = 0;
+	while(pos < length) {
+		unsigned int at_t = _slot(pos);
+		unsigned int at_c = cmp._slot(pos);
+		unsigned int run = std::min({length - pos, slots - at_t, cmp.slots - at_c});
+		if(!std::equal(keys + at_t, keys + at_t + run, cmp.keys + at_c) ||
+		   !std::equal(infos + at_t, infos + at_t + run, cmp.infos + at_c)) {
+			return false;
+		}
+		pos += run;
+	}
+	//loop exited without mismatches
+	return true;
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::operator!=(const bi_ring_buffer<Key, Info>& cmp) const {
+	return !(*this == cmp);
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>& bi_ring_buffer<Key, Info>::operator=(const bi_ring_buffer<Key, Info>& src) {
+	//clone helper checks every condition
+	_clone(src);
+	return *this;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>& bi_ring_buffer<Key, Info>::operator=(bi_ring_buffer<Key, Info>&& src) {
+	//check for self assign
+	if(this != &src) {
+		//clear itself and take over src buffers
+		_release();
+		std::swap(length, src.length);
+		std::swap(head, src.head);
+		std::swap(slots, src.slots);
+		std::swap(keys, src.keys);
+		std::swap(infos, src.infos);
+		_trade_owner(src);
+	}
+	return *this;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> bi_ring_buffer<Key, Info>::operator+(const bi_ring_buffer<Key, Info>& src) const & {
+	//create new to return combined
+	bi_ring_buffer<Key, Info> newRing(*this);
+	newRing.reserve(length + src.length);
+	for(unsigned int pos = 0; pos < src.length; pos++) {
+		unsigned int at = src._slot(pos);
+		newRing.push(src.keys[at], src.infos[at]);
+	}
+	return newRing;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>& bi_ring_buffer<Key, Info>::operator+=(const bi_ring_buffer<Key, Info>& src) {
+	//appending copies src only, self-append is snapshotted by the size
+	unsigned int count = src.length;
+	reserve(length + count);
+	for(unsigned int pos = 0; pos < count; pos++) {
+		unsigned int at = src._slot(pos);
+		push(src.keys[at], src.infos[at]);
+	}
+	return *this;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> bi_ring_buffer<Key, Info>::operator+(const bi_ring_buffer<Key, Info>& src) && {
+	//reuse storage of the temporary
+	bi_ring_buffer<Key, Info> newRing(std::move(*this));
+	newRing += src;
+	return newRing;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> bi_ring_buffer<Key, Info>::operator+(bi_ring_buffer<Key, Info>&& src) const & {
+	bi_ring_buffer<Key, Info> newRing(*this);
+	newRing += std::move(src);
+	return newRing;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> bi_ring_buffer<Key, Info>::operator+(bi_ring_buffer<Key, Info>&& src) && {
+	bi_ring_buffer<Key, Info> newRing(std::move(*this));
+	newRing += std::move(src);
+	return newRing;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>& bi_ring_buffer<Key, Info>::operator+=(bi_ring_buffer<Key, Info>&& src) {
+	if(this == &src) {
+		return *this += static_cast<const bi_ring_buffer<Key, Info>&>(src);
+	}
+	//move payloads over, src is left empty
+	reserve(length + src.length);
+	for(unsigned int pos = 0; pos < src.length; pos++) {
+		unsigned int at = src._slot(pos);
+		push(std::move(src.keys[at]), std::move(src.infos[at]));
+	}
+	src.purge();
+	return *this;
+}
+
+template <typename Key, typename Info>
+std::ostream& operator<<(std::ostream& str, const bi_ring_buffer<Key, Info>& seq) {
+	//formatted into a buffer, the stream sees a few large writes
+	text_output out(str);
+	for(auto itr = seq.begin(); itr != seq.end(); ++itr) {
+		out << '[' << itr.key()
+		<< "] " << itr.info() << '\n';
+	}
+	out.flush();
+	return str;
+}
+
+/*
+	INSERTION METHODS
+*/
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::push(const Key& key, const Info& inf) {
+	return emplace(key, inf);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::push(Key key, Info&& inf) {
+	return emplace(std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::insert_after(const Key& key, const Info& inf,
+					iterator what) {
+	return emplace_after(what, key, inf);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::insert_after(Key key, Info&& inf,
+					iterator what) {
+	return emplace_after(what, std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::insert_before(const Key& key, const Info& inf,
+					 iterator what) {
+	return emplace_before(what, key, inf);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::insert_before(Key key, Info&& inf,
+					 iterator what) {
+	return emplace_before(what, std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::replace(const Key& key, const Info& inf,
+					iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	what.key() = key;
+	what.info() = inf;
+	return true;
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::replace(Key key, Info&& inf,
+					iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	what.key() = std::move(key);
+	what.info() = std::move(inf);
+	return true;
+}
+
+template <typename Key, typename Info>
+template <typename K, typename... Args>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::emplace(K&& key, Args&&... args) {
+	//append behind the last element
+	return _insert(length, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Info>
+template <typename K, typename... Args>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::emplace_after(iterator what, K&& key, Args&&... args) {
+	//invalid iterator, abort
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _insert(what.pos + 1, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Info>
+template <typename K, typename... Args>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::emplace_before(iterator what, K&& key, Args&&... args) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	//before the first element is behind the last one
+	return _insert(what.pos ? what.pos : length, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+/*
+	REMOVAL METHODS
+*/
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::purge() {
+	//check if sequence is empty
+	if(empty()) {
+		return false;
+	}
+	//destroy elements, the buffers are kept for reuse
+	for(unsigned int pos = 0; pos < length; pos++) {
+		unsigned int at = _slot(pos);
+		keys[at].~Key();
+		infos[at].~Info();
+	}
+	length = 0;
+	head = 0;
+	return true;
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::remove_after(iterator what) {
+	//check if we even can do this
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _erase((++what).pos);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::remove_before(iterator what) {
+	//check if iterator is valid
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _erase((--what).pos);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::remove(iterator what) {
+	//check if iterator is valid
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _erase(what.pos);
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::empty() const {
+	return !length;
+}
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::size() const {
+	return length;
+}
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::capacity() const {
+	return slots;
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::print() const {
+	//check if sequence is empty
+	if(empty()) {
+		std::cout << "Ring empty!\n";
+		return;
+	}
+	//iterate through all elements printing, flushing once at the end
+	text_output out(std::cout);
+	for(const_iterator itr = begin(); itr != end(); ++itr) {
+		out << "Key " << itr.key() << ": " << itr.info() << '\n';
+	}
+	out.flush();
+	std::cout.flush();
+}
+
+template <typename Key, typename Info>
+const Info& bi_ring_buffer<Key, Info>::get_info(const Key& key, int n_key) const {
+	unsigned int pos = _find(key, n_key);
+	if(pos != length) {
+		return infos[_slot(pos)];
+	}
+	throw std::invalid_argument("Specified key not found");
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::find(const Key& key, int n_key) const {
+	//invalid iterator if there's no such occurrence
+	unsigned int pos = _find(key, n_key);
+	if(pos == length) {
+		return const_iterator();
+	}
+	return const_iterator(this, pos);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::find(const Key& key, int n_key) {
+	return iterator(static_cast<const bi_ring_buffer<Key, Info>&>(*this).find(key, n_key));
+}
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::count(const Key& key) const {
+	//keys occupy at most two contiguous spans
+	unsigned int first = std::min(length, slots - head);
+	return key_count(keys + head, first, key) + key_count(keys, length - first, key);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::begin() const {
+	//construct new iterator to the first element
+	return const_iterator(*this);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::end() const {
+	//first element again, one lap on
+	return empty() ? const_iterator() : const_iterator(this, 0, 1);
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::at(unsigned int pos) const {
+	if(pos >= length) {
+		throw std::out_of_range("Position exceeds ring size.");
+	}
+	return const_iterator(this, pos);
+}
+
+/*
+	UTILITY METHODS
+*/
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::clear_info(const Info& filler) {
+	//check for empty ring
+	if(empty()) {
+		return false;
+	}
+	//fill both contiguous spans of the buffer
+	unsigned int first = std::min(length, slots - head);
+	std::fill(infos + head, infos + head + first, filler);
+	std::fill(infos, infos + (length - first), filler);
+	return true;
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::swap(iterator what, iterator dest) {
+	//at least one of the iterators is invalid
+	if(!what.valid() || !dest.valid()) {
+		return false;
+	}
+	//swap payloads
+	using std::swap;
+	swap(what.key(), dest.key());
+	swap(what.info(), dest.info());
+	return true;
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::swap(bi_ring_buffer<Key, Info>& other) {
+	//hand over both arrays
+	std::swap(length, other.length);
+	std::swap(head, other.head);
+	std::swap(slots, other.slots);
+	std::swap(keys, other.keys);
+	std::swap(infos, other.infos);
+	_trade_owner(other);
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::reserve(unsigned int count) {
+	if(count > slots) {
+		_grow(count);
+	}
+}
+
+/*
+	HELPERS
+*/
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::_slot(unsigned int pos) const {
+	return (head + pos) & (slots - 1);
+}
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::_find(const Key& key, int n_key) const {
+	//check if argument is even valid
+	if(n_key < 1) {
+		throw std::invalid_argument("Key occurrence number cannot be negative");
+	}
+	//scan both contiguous spans of keys
+	unsigned int nth = n_key;
+	unsigned int first = std::min(length, slots - head);
+	unsigned int found = key_locate(keys + head, first, key, nth);
+	if(found != first) {
+		return found;
+	}
+	//gives back past the end position if failed
+	return first + key_locate(keys, length - first, key, nth);
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::_clone(const bi_ring_buffer<Key, Info>& src) {
+	//self-clone
+	if(this == &src) {
+		return true;
+	}
+	reserve(src.length);
+	//overwrite elements already in place
+	unsigned int reused = std::min(length, src.length);
+	for(unsigned int pos = 0; pos < reused; pos++) {
+		keys[_slot(pos)] = src.keys[src._slot(pos)];
+		infos[_slot(pos)] = src.infos[src._slot(pos)];
+	}
+	//drop the surplus or construct the rest
+	while(length > src.length) {
+		length--;
+		keys[_slot(length)].~Key();
+		infos[_slot(length)].~Info();
+	}
+	while(length < src.length) {
+		push(src.keys[src._slot(length)], src.infos[src._slot(length)]);
+	}
+	return true;
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::_trade_owner(bi_ring_buffer<Key, Info>& other) {
+	//iterators follow the elements to the ring now holding them
+	Owner* mine = owner.load(std::memory_order_relaxed);
+	Owner* theirs = other.owner.load(std::memory_order_relaxed);
+	owner.store(theirs, std::memory_order_relaxed);
+	other.owner.store(mine, std::memory_order_relaxed);
+	if(theirs != nullptr) {
+		theirs -> ring = this;
+	}
+	if(mine != nullptr) {
+		mine -> ring = &other;
+	}
+}
+
+template <typename Key, typename Info>
+const typename bi_ring_buffer<Key, Info>::Owner* bi_ring_buffer<Key, Info>::_owner() const {
+	//concurrent const passes may race to make it, only one is kept
+	Owner* made = owner.load(std::memory_order_acquire);
+	if(made == nullptr) {
+		Owner* fresh = new Owner{const_cast<bi_ring_buffer<Key, Info>*>(this)};
+		if(owner.compare_exchange_strong(made, fresh, std::memory_order_acq_rel)) {
+			made = fresh;
+		}
+		else {
+			delete fresh;
+		}
+	}
+	return made;
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::_relocate(unsigned int from, unsigned int to) {
+	//move into an unoccupied slot, leaving the source slot unoccupied
+	::new (static_cast<void*>(keys + to)) Key(std::move(keys[from]));
+	::new (static_cast<void*>(infos + to)) Info(std::move(infos[from]));
+	keys[from].~Key();
+	infos[from].~Info();
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::_grow(unsigned int count) {
+	//next power of two, so positions wrap with a mask
+	unsigned int grown = slots ? slots : 8;
+	while(grown < count) {
+		grown *= 2;
+	}
+	Key* new_keys = static_cast<Key*>(::operator new(grown * sizeof(Key),
+							 std::align_val_t(line_size)));
+	Info* new_infos = nullptr;
+	unsigned int keys_made = 0;
+	unsigned int infos_made = 0;
+	//straighten the ring out while moving it over, elements whose move may
+	//throw are copied, so the old arrays stay whole until all are over
+	try {
+		new_infos = static_cast<Info*>(::operator new(grown * sizeof(Info),
+							      std::align_val_t(line_size)));
+		for(unsigned int pos = 0; pos < length; pos++) {
+			unsigned int at = _slot(pos);
+			::new (static_cast<void*>(new_keys + pos)) Key(std::move_if_noexcept(keys[at]));
+			keys_made++;
+			::new (static_cast<void*>(new_infos + pos)) Info(std::move_if_noexcept(infos[at]));
+			infos_made++;
+		}
+	}
+	catch(...) {
+		for(unsigned int pos = 0; pos < keys_made; pos++) {
+			new_keys[pos].~Key();
+		}
+		for(unsigned int pos = 0; pos < infos_made; pos++) {
+			new_infos[pos].~Info();
+		}
+		::operator delete(new_keys, std::align_val_t(line_size));
+		if(new_infos != nullptr) {
+			::operator delete(new_infos, std::align_val_t(line_size));
+		}
+		throw;
+	}
+	//old elements are destroyed along with their arrays
+	unsigned int count_kept = length;
+	_release();
+	keys = new_keys;
+	infos = new_infos;
+	slots = grown;
+	length = count_kept;
+	head = 0;
+}
+
+template <typename Key, typename Info>
+void bi_ring_buffer<Key, Info>::_release() {
+	purge();
+	if(slots) {
+		::operator delete(keys, std::align_val_t(line_size));
+		::operator delete(infos, std::align_val_t(line_size));
+	}
+	keys = nullptr;
+	infos = nullptr;
+	slots = 0;
+}
+
+template <typename Key, typename Info>
+template <typename K, typename... Args>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::_insert(unsigned int pos, K&& key, Args&&... args) {
+	//build payload up front, so shifting never has to be undone
+	Key new_key(std::forward<K>(key));
+	Info new_info(std::forward<Args>(args)...);
+	if(length == slots) {
+		_grow(length + 1);
+	}
+	if(pos < length - pos) {
+		//shift the front one slot towards the start
+		head = (head + slots - 1) & (slots - 1);
+		for(unsigned int i = 0; i < pos; i++) {
+			_relocate(_slot(i + 1), _slot(i));
+		}
+	}
+	else {
+		//shift the back one slot towards the end
+		for(unsigned int i = length; i > pos; i--) {
+			_relocate(_slot(i - 1), _slot(i));
+		}
+	}
+	unsigned int at = _slot(pos);
+	::new (static_cast<void*>(keys + at)) Key(std::move(new_key));
+	::new (static_cast<void*>(infos + at)) Info(std::move(new_info));
+	length++;
+	return iterator(const_iterator(this, pos));
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::_erase(unsigned int pos) {
+	unsigned int at = _slot(pos);
+	keys[at].~Key();
+	infos[at].~Info();
+	if(pos < length - 1 - pos) {
+		//shift the front one slot towards the end
+		for(unsigned int i = pos; i > 0; i--) {
+			_relocate(_slot(i - 1), _slot(i));
+		}
+		head = (head + 1) & (slots - 1);
+	}
+	else {
+		//shift the back one slot towards the start
+		for(unsigned int i = pos + 1; i < length; i++) {
+			_relocate(_slot(i), _slot(i - 1));
+		}
+	}
+	length--;
+	//successor now sits at the same position, or wrapped to the start
+	if(!length) {
+		head = 0;
+		return iterator();
+	}
+	return iterator(pos < length ? const_iterator(this, pos) : end());
+}
+
+/*
+	ITERATORS
+*/
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::const_iterator::const_iterator() {
+	owner = nullptr;
+	pos = 0;
+	lap = 0;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::const_iterator::const_iterator(const bi_ring_buffer<Key, Info>& of)
+	: const_iterator(of.empty() ? nullptr : &of, 0) {
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::const_iterator::const_iterator(const bi_ring_buffer<Key, Info>& of,
+							  const Key& key, int n_key) {
+	unsigned int found = of._find(key, n_key);
+	owner = found != of.length ? of._owner() : nullptr;
+	pos = found != of.length ? found : 0;
+	lap = 0;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::const_iterator::const_iterator(const const_iterator& src) {
+	owner = src.owner;
+	pos = src.pos;
+	lap = src.lap;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::const_iterator::const_iterator(const bi_ring_buffer<Key, Info>* of,
+							  unsigned int at, int laps) {
+	owner = of != nullptr ? of -> _owner() : nullptr;
+	pos = at;
+	lap = laps;
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::const_iterator&
+bi_ring_buffer<Key, Info>::const_iterator::operator=(const const_iterator& src) {
+	owner = src.owner;
+	pos = src.pos;
+	lap = src.lap;
+	return *this;
+}
+
+template <typename Key, typename Info>
+//prefix
+typename bi_ring_buffer<Key, Info>::const_iterator&
+bi_ring_buffer<Key, Info>::const_iterator::operator++() {
+	if(iterator_checks::enabled && owner == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	if(++pos == owner -> ring -> length) {
+		pos = 0;
+		lap++;
+	}
+	return *this;
+}
+
+template <typename Key, typename Info>
+//postfix
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::const_iterator::operator++(int ops) {
+	const_iterator prev(*this);
+	if(!ops) {
+		++(*this);
+		return prev;
+	}
+	if(iterator_checks::enabled && owner == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	//jump straight to the target position
+	if(ops > 0) {
+		unsigned long long target = static_cast<unsigned long long>(pos) + ops;
+		lap += static_cast<int>(target / owner -> ring -> length);
+		pos = static_cast<unsigned int>(target % owner -> ring -> length);
+	}
+	return prev;
+}
+
+template <typename Key, typename Info>
+//prefix
+typename bi_ring_buffer<Key, Info>::const_iterator&
+bi_ring_buffer<Key, Info>::const_iterator::operator--() {
+	if(iterator_checks::enabled && owner == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	if(!pos) {
+		pos = owner -> ring -> length;
+		lap--;
+	}
+	pos--;
+	return *this;
+}
+
+template <typename Key, typename Info>
+//postfix
+typename bi_ring_buffer<Key, Info>::const_iterator
+bi_ring_buffer<Key, Info>::const_iterator::operator--(int ops) {
+	const_iterator prev(*this);
+	if(!ops) {
+		--(*this);
+		return prev;
+	}
+	if(iterator_checks::enabled && owner == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	//jump straight to the target position
+	if(ops > 0) {
+		unsigned int back = ops % owner -> ring -> length;
+		lap -= static_cast<int>(ops / owner -> ring -> length) + (back > pos);
+		pos = (pos + owner -> ring -> length - back) % owner -> ring -> length;
+	}
+	return prev;
+}
+
+template <typename Key, typename Info>
+const Info& bi_ring_buffer<Key, Info>::const_iterator::operator*() const {
+	return info();
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::const_iterator::operator==(const const_iterator& cmp) const {
+	return owner == cmp.owner && pos == cmp.pos && lap == cmp.lap;
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::const_iterator::operator!=(const const_iterator& cmp) const {
+	return !(*this == cmp);
+}
+
+template <typename Key, typename Info>
+const Key& bi_ring_buffer<Key, Info>::const_iterator::key() const {
+	if(!iterator_checks::enabled || owner != nullptr) {
+		return owner -> ring -> keys[owner -> ring -> _slot(pos)];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info>
+const Info& bi_ring_buffer<Key, Info>::const_iterator::info() const {
+	if(!iterator_checks::enabled || owner != nullptr) {
+		return owner -> ring -> infos[owner -> ring -> _slot(pos)];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info>
+bool bi_ring_buffer<Key, Info>::const_iterator::valid() const {
+	return owner != nullptr;
+}
+
+template <typename Key, typename Info>
+unsigned int bi_ring_buffer<Key, Info>::const_iterator::position() const {
+	if(iterator_checks::enabled && owner == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	return pos;
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info>::iterator::iterator(const const_iterator& src) {
+	iterator::owner = src.owner;
+	iterator::pos = src.pos;
+	iterator::lap = src.lap;
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator&
+bi_ring_buffer<Key, Info>::iterator::operator++() {
+	const_iterator::operator++();
+	return *this;
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::iterator::operator++(int ops) {
+	return iterator(const_iterator::operator++(ops));
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator&
+bi_ring_buffer<Key, Info>::iterator::operator--() {
+	const_iterator::operator--();
+	return *this;
+}
+
+template <typename Key, typename Info>
+typename bi_ring_buffer<Key, Info>::iterator
+bi_ring_buffer<Key, Info>::iterator::operator--(int ops) {
+	return iterator(const_iterator::operator--(ops));
+}
+
+template <typename Key, typename Info>
+Info& bi_ring_buffer<Key, Info>::iterator::operator*() {
+	return info();
+}
+
+template <typename Key, typename Info>
+Key& bi_ring_buffer<Key, Info>::iterator::key() {
+	if(!iterator_checks::enabled || iterator::owner != nullptr) {
+		return iterator::owner -> ring -> keys[iterator::owner -> ring -> _slot(iterator::pos)];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info>
+Info& bi_ring_buffer<Key, Info>::iterator::info() {
+	if(!iterator_checks::enabled || iterator::owner != nullptr) {
+		return iterator::owner -> ring -> infos[iterator::owner -> ring -> _slot(iterator::pos)];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+/*
+	EXTERNAL FUNCTIONS
+*/
+
+template <typename Key, typename Info>
+void swap(bi_ring_buffer<Key, Info>& first, bi_ring_buffer<Key, Info>& secnd) {
+	first.swap(secnd);
+}
+
+template <typename Key, typename Info>
+bi_ring_buffer<Key, Info> shuffle(const bi_ring_buffer<Key, Info>& first, unsigned int fcnt,
+				  const bi_ring_buffer<Key, Info>& secnd, unsigned int scnt,
+				  unsigned int reps) {
+	//require two rings to be non-empty
+	if( !first.size() || !secnd.size() ) {
+		throw std::invalid_argument("One of the rings is empty.");
+	}
+	//require parameters to be non-zero
+	if( !fcnt || !scnt || !reps ) {
+		throw std::invalid_argument("These count parameters result in no shuffling.");
+	}
+	//start shuffling
+	bi_ring_buffer<Key, Info> newRing;
+	newRing.reserve((fcnt + scnt) * reps);
+	typename bi_ring_buffer<Key, Info>::const_iterator itr_f(first);
+	typename bi_ring_buffer<Key, Info>::const_iterator itr_s(secnd);
+	for(unsigned int i = 0; i < reps; i++) {
+		for(unsigned int j = 0; j < fcnt; j++) {
+			newRing.push(itr_f.key(), itr_f.info());
+			itr_f++;
+		}
+		for(unsigned int j = 0; j < scnt; j++) {
+			newRing.push(itr_s.key(), itr_s.info());
+			itr_s++;
+		}
+	}
+	//everything succeeded, return shuffled result
+	return newRing;
+}
@@ -8,13 +8,19 @@
 	ELEMENT OPERATOR OVERLOADS
 */
 
-template <typename Key, typename Info>
-bool bi_ring<Key, Info>::Element::operator==(const Element& cmp) const {
+template <typename Key, typename Info, typename Alloc>
+template <typename K, typename... Args>
+bi_ring<Key, Info, Alloc>::Element::Element(Element* nxt, Element* prv, K&& k, Args&&... args)
+	: key(std::forward<K>(k)), info(std::forward<Args>(args)...), next(nxt), prev(prv) {
+}
+
+template <typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::Element::operator==(const Element& cmp) const {
 	return (key == cmp.key && info == cmp.info);
 }
 
-template <typename Key, typename Info>
-bool bi_ring<Key, Info>::Element::operator!=(const Element& cmp) const {
+template <typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::Element::operator!=(const Element& cmp) const {
 	return !(*this == cmp);
 }
 
@@ -22,49 +28,106 @@ bool bi_ring<Key, Info>::Element::operator!=(const Element& cmp) const {
 	(DE)CONSTRUCTORS
 */
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::bi_ring() {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring() {
+	any = nullptr;
+	length = 0;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(const Alloc& alloc) : pool(alloc) {
 	any = nullptr;
 	length = 0;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::bi_ring(const Key& key, const Info& inf) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(const Key& key, const Info& inf,
+				   const Alloc& alloc) : pool(alloc) {
 	any = nullptr;
 	length = 0;
 	//push initial first element
 	push(key, inf);
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::bi_ring(const bi_ring<Key, Info>& src) {
+template<typename Key, typename Info, typename Alloc>
+template <typename InputIt, typename>
+bi_ring<Key, Info, Alloc>::bi_ring(InputIt first, InputIt last,
+				   const Alloc& alloc) : pool(alloc) {
+	any = nullptr;
+	length = 0;
+	_insert_range(nullptr, first, last);
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(std::initializer_list<std::pair<Key, Info>> items,
+				   const Alloc& alloc) : pool(alloc) {
+	any = nullptr;
+	length = 0;
+	_insert_range(nullptr, items.begin(), items.end());
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(const bi_ring<Key, Info, Alloc>& src)
+	: bi_ring(src, alloc_traits::select_on_container_copy_construction(src.get_allocator())) {
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(const bi_ring<Key, Info, Alloc>& src,
+				   const Alloc& alloc) : pool(alloc) {
 	any = nullptr;
 	length = 0;
+	//copies keep the lookup mode of their source
+	if constexpr(is_hashable<Key>::value) {
+		if(src.indexed()) {
+			enable_index();
+		}
+	}
+	if(src.positioned()) {
+		enable_positions();
+	}
 	//run the clone helper on this object
 	_clone(src);
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::bi_ring(bi_ring<Key, Info>&& src) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(bi_ring<Key, Info, Alloc>&& src)
+	: pool(std::move(src.pool)), lookup(std::move(src.lookup)), order(std::move(src.order)) {
 	//move src content ownership
 	any = src.any;
 	length = src.length;
+	_trade_owner(src);
 	//disconnect source from its content
 	src.any = nullptr;
 	src.length = 0;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::~bi_ring() {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::bi_ring(bi_ring<Key, Info, Alloc>&& src,
+				   const Alloc& alloc) : pool(alloc) {
+	any = nullptr;
+	length = 0;
+	//nodes can only change hands between equal allocators
+	if(alloc == src.get_allocator()) {
+		_take(src);
+	}
+	else {
+		_clone(src);
+		src.purge();
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::~bi_ring() {
 	purge();
+	delete owner.load();
 }
 
 /*
 	OPERATORS
 */
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::operator==(const bi_ring<Key, Info>& cmp) const {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::operator==(const bi_ring<Key, Info, Alloc>& cmp) const {
 	//check for comparison to self
 	if(this == &cmp) {
 		return true;
@@ -79,54 +142,60 @@ bool bi_ring<Key, Info>::operator==(const bi_ring<Key, Info>& cmp) const {
 		return true;
 	}
 	//then start comparing elements
-	const_iterator itr_t(*this);
 	const_iterator itr_c(cmp);
-	do {
+	for(const_iterator itr_t = begin(); itr_t != end(); ++itr_t, ++itr_c) {
 		if(*itr_t.current != *itr_c.current) {
 		   return false;
 		}
-		itr_t++;
-		itr_c++;
-	} while(itr_t != begin());
+	}
 	//loop exited without mismatches
 	return true;
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::operator!=(const bi_ring<Key, Info>& cmp) const {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::operator!=(const bi_ring<Key, Info, Alloc>& cmp) const {
 	return !(*this == cmp);
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>& bi_ring<Key, Info>::operator=(const bi_ring<Key, Info>& src) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>& bi_ring<Key, Info, Alloc>::operator=(const bi_ring<Key, Info, Alloc>& src) {
+	//nodes of a propagated allocator must not outlive the old one
+	if constexpr(alloc_traits::propagate_on_container_copy_assignment::value) {
+		if(this != &src && get_allocator() != src.get_allocator()) {
+			purge();
+			pool.reset(src.get_allocator());
+		}
+	}
 	//clone helper checks every condition
 	_clone(src);
 	return *this;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>& bi_ring<Key, Info>::operator=(bi_ring<Key, Info>&& src) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>& bi_ring<Key, Info, Alloc>::operator=(bi_ring<Key, Info, Alloc>&& src) {
 	//check for self assign
-	if(this != &src) {
-		//clear itself
-		purge();
-		//move ownership of src contents
-		any = src.any;
-		length = src.length;
-		//disconnect source from its content
-		src.any = nullptr;
-		src.length = 0;
+	if(this == &src) {
+		return *this;
+	}
+	//nodes can only change hands if the allocator follows them
+	if(alloc_traits::propagate_on_container_move_assignment::value ||
+	   get_allocator() == src.get_allocator()) {
+		_take(src);
+	}
+	else {
+		_clone(src);
+		src.purge();
 	}
 	return *this;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info> bi_ring<Key, Info>::operator+(const bi_ring<Key, Info>& src) const {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> bi_ring<Key, Info, Alloc>::operator+(const bi_ring<Key, Info, Alloc>& src) const & {
 	Element* current = src.any;
 	//if target list is empty return unchanged
 	if(current == nullptr) return *this;
 	//otherwise create new to return combined
-	bi_ring<Key, Info> newRing(*this);
+	bi_ring<Key, Info, Alloc> newRing(*this);
 	do {
 		newRing.push(current -> key, current -> info);
 		current = current -> next;
@@ -134,25 +203,59 @@ bi_ring<Key, Info> bi_ring<Key, Info>::operator+(const bi_ring<Key, Info>& src)
 	return newRing;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>& bi_ring<Key, Info>::operator+=(const bi_ring<Key, Info>& src) {
-	//uses + operator to append to self
-	*this = *this + src;
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> bi_ring<Key, Info, Alloc>::operator+(const bi_ring<Key, Info, Alloc>& src) && {
+	//reuse nodes of the temporary
+	bi_ring<Key, Info, Alloc> newRing(std::move(*this));
+	newRing += src;
+	return newRing;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> bi_ring<Key, Info, Alloc>::operator+(bi_ring<Key, Info, Alloc>&& src) const & {
+	bi_ring<Key, Info, Alloc> newRing(*this);
+	newRing += std::move(src);
+	return newRing;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> bi_ring<Key, Info, Alloc>::operator+(bi_ring<Key, Info, Alloc>&& src) && {
+	bi_ring<Key, Info, Alloc> newRing(std::move(*this));
+	newRing += std::move(src);
+	return newRing;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>& bi_ring<Key, Info, Alloc>::operator+=(const bi_ring<Key, Info, Alloc>& src) {
+	//append copies of src only, self-append is snapshotted by the size
+	Element* current = src.any;
+	unsigned int count = src.length;
+	for(unsigned int i = 0; i < count; i++) {
+		push(current -> key, current -> info);
+		current = current -> next;
+	}
 	return *this;
 }
 
-template<typename Key, typename Info>
-std::ostream& operator<< (std::ostream& str, const bi_ring<Key, Info>& seq) {
-	typename bi_ring<Key, Info>::Element* current = seq.any;
-	//if ring is empty, return
-	if(current == nullptr) return str;
-	//non empty ring
-	typename bi_ring<Key, Info>::const_iterator itr(seq);
-	do {
-		str << '[' << itr.key()
-		<< "] " << itr.info() << "\n";
-		itr++;
-	} while(itr != seq.begin());
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>& bi_ring<Key, Info, Alloc>::operator+=(bi_ring<Key, Info, Alloc>&& src) {
+	if(this == &src) {
+		return *this += static_cast<const bi_ring<Key, Info, Alloc>&>(src);
+	}
+	//behind the last element is before the first one
+	splice(begin(), std::move(src));
+	return *this;
+}
+
+template<typename Key, typename Info, typename Alloc>
+std::ostream& operator<< (std::ostream& str, const bi_ring<Key, Info, Alloc>& seq) {
+	//formatted into a buffer, the stream sees a few large writes
+	text_output out(str);
+	for(auto itr = seq.begin(); itr != seq.end(); ++itr) {
+		out << '[' << itr.key()
+		<< "] " << itr.info() << '\n';
+	}
+	out.flush();
 	return str;
 }
 
@@ -160,11 +263,79 @@ std::ostream& operator<< (std::ostream& str, const bi_ring<Key, Info>& seq) {
 	INSERTION METHODS
 */
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::push(const Key& key, const Info& inf) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::push(const Key& key, const Info& inf) {
+	return emplace(key, inf);
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::push(Key key, Info&& inf) {
+	return emplace(std::move(key), std::move(inf));
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::insert_after(const Key& key,  const Info& inf, 
+		  		 iterator what) {
+	return emplace_after(what, key, inf);
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::insert_after(Key key, Info&& inf,
+				 iterator what) {
+	return emplace_after(what, std::move(key), std::move(inf));
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator 
+bi_ring<Key, Info, Alloc>::insert_before(const Key& key,  const Info& inf, 
+		  		  iterator what) {
+	return emplace_before(what, key, inf);
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::insert_before(Key key, Info&& inf,
+				  iterator what) {
+	return emplace_before(what, std::move(key), std::move(inf));
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::replace(const Key& key,   const Info& inf, 
+		     		 iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	//re-file the element under its new key
+	_index_unfile(what.current);
+	what.key() = key;
+	what.info() = inf;
+	_index_file(what.current);
+	return true;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::replace(Key key, Info&& inf,
+				 iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	_index_unfile(what.current);
+	what.key() = std::move(key);
+	what.info() = std::move(inf);
+	_index_file(what.current);
+	return true;
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename K, typename... Args>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::emplace(K&& key, Args&&... args) {
 	//add new element to the front
-	Element* temp = new Element({key, inf, nullptr, nullptr});
+	Element* temp = _create(nullptr, nullptr, std::forward<K>(key), std::forward<Args>(args)...);
 	//non empty list
 	if(!empty()) {
 		//emplace new element
@@ -181,44 +352,141 @@ bi_ring<Key, Info>::push(const Key& key, const Info& inf) {
 		any = temp;
 	}
 	length++;
-	return iterator(temp);
+	_index_insert(temp);
+	_order_insert(temp);
+	return iterator(this, temp);
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::insert_after(const Key& key,  const Info& inf, 
-		  		 iterator what) {
-	what = what.insert_after(key, inf);
+template<typename Key, typename Info, typename Alloc>
+template <typename K, typename... Args>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::emplace_after(iterator what, K&& key, Args&&... args) {
+	what = what.insert_after(*this, std::forward<K>(key), std::forward<Args>(args)...);
 	length++;
+	_index_insert(what.current);
+	_order_insert(what.current);
 	return what;
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator 
-bi_ring<Key, Info>::insert_before(const Key& key,  const Info& inf, 
-		  		  iterator what) {
-	what = what.insert_before(key, inf);
+template<typename Key, typename Info, typename Alloc>
+template <typename K, typename... Args>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::emplace_before(iterator what, K&& key, Args&&... args) {
+	what = what.insert_before(*this, std::forward<K>(key), std::forward<Args>(args)...);
 	length++;
+	_index_insert(what.current);
+	_order_insert(what.current);
 	return what;
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::replace(const Key& key,   const Info& inf, 
-		     		 iterator what) {
-	if(!what.valid()) {
-		return false;
+template<typename Key, typename Info, typename Alloc>
+template <typename InputIt, typename>
+void bi_ring<Key, Info, Alloc>::append(InputIt first, InputIt last) {
+	//in front of any is behind the last element
+	_insert_range(any, first, last);
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename InputIt, typename>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::insert_after(iterator pos, InputIt first, InputIt last) {
+	if(!pos.valid()) {
+		throw std::domain_error(itrinvl_exc);
 	}
-	what.key() = key;
-	what.info() = inf;
-	return true;
+	Element* tail = _insert_range(pos.current -> next, first, last);
+	return tail != nullptr ? iterator(this, tail) : pos;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::splice(iterator pos, bi_ring<Key, Info, Alloc>&& other) {
+	if(this == &other || other.empty()) {
+		return;
+	}
+	if(!empty() && !pos.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	//nodes from another pool need an equal allocator to be freed later
+	if(!(pool.get_allocator() == other.pool.get_allocator())) {
+		_move_range(pos.current, other, other.any, other.any);
+		return;
+	}
+	pool.adopt(other.pool);
+	Element* first = other.any;
+	Element* tail = first -> prev;
+	unsigned int count = other.length;
+	//other gives up every node, drop its indexes and blocks along
+	other.any = nullptr;
+	other.length = 0;
+	other._index_clear();
+	if(other.order) {
+		other.order -> clear();
+	}
+	other.pool.reset(other.pool.get_allocator());
+	_link(pos.current, first, tail, count);
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::splice(iterator pos, bi_ring<Key, Info, Alloc>& other,
+				iterator first, iterator last) {
+	if(!first.valid() || !last.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	if(!empty() && !pos.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	if(first == last) {
+		return;
+	}
+	//same node a lap apart spans the whole ring, starting from first
+	if(first.current == last.current) {
+		if(this == &other) {
+			throw std::invalid_argument("Splice position lies inside the moved range.");
+		}
+		other.any = first.current;
+		splice(pos, std::move(other));
+		return;
+	}
+	//nodes from another pool need an equal allocator to be freed later
+	if(this != &other && !(pool.get_allocator() == other.pool.get_allocator())) {
+		_move_range(pos.current, other, first.current, last.current);
+		return;
+	}
+	//walk the range once to size it, holding the blocks its nodes live in
+	unsigned int count = 0;
+	bool has_any = false;
+	Element* tail = nullptr;
+	for(Element* current = first.current; current != last.current; current = current -> next) {
+		if(current == pos.current) {
+			throw std::invalid_argument("Splice position lies inside the moved range.");
+		}
+		if(this != &other) {
+			pool.adopt(other.pool, current);
+		}
+		has_any = has_any || current == other.any;
+		tail = current;
+		count++;
+	}
+	//take the range out of other, last stays behind
+	for(Element* current = first.current; current != last.current; current = current -> next) {
+		other._index_erase(current);
+		other._order_erase(current);
+	}
+	first.current -> prev -> next = last.current;
+	last.current -> prev = first.current -> prev;
+	if(has_any) {
+		other.any = last.current;
+	}
+	other.length -= count;
+	other.revision++;
+	_link(pos.current, first.current, tail, count);
 }
 
 /*
 	REMOVAL METHODS
 */
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::purge() {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::purge() {
 	//check if sequence is empty
 	if(empty()) {
 		return false;
@@ -228,45 +496,49 @@ bool bi_ring<Key, Info>::purge() {
 	Element* next;
 	do {
 		next = current -> next;
-		delete current;
+		_destroy(current);
 		current = next;
 	} while(current != any);
 	//mark sequence as empty again
 	any = nullptr;
 	length = 0;
+	_index_clear();
+	if(order) {
+		order -> clear();
+	}
 	return true;
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::remove_after(iterator what) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::remove_after(iterator what) {
 	//check if we even can do this
 	if(!what.valid()) {
 		throw std::domain_error(itrinvl_exc);
 	}
 	//remove using iterator's private method
-	iterator elementAfter(what.current -> next);
+	iterator elementAfter(this, what.current -> next);
 	length--;
 	return elementAfter.remove(*this);
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator 
-bi_ring<Key, Info>::remove_before(iterator what) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator 
+bi_ring<Key, Info, Alloc>::remove_before(iterator what) {
 	//check if iterator is valid
 	if(!what.valid()) {
 		throw std::domain_error(itrinvl_exc);
 	}
 	//remove using iterator's private method
-	iterator elementBefore(what.current->prev);
+	iterator elementBefore(this, what.current->prev);
 	length--;
 	return elementBefore.remove(*this);
 }
 
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::remove(iterator what) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::remove(iterator what) {
 	//check if iterator is valid
 	if(!what.valid()) {
 		throw std::domain_error(itrinvl_exc);
@@ -276,22 +548,92 @@ bi_ring<Key, Info>::remove(iterator what) {
 	return what.remove(*this);
 }
 
+template<typename Key, typename Info, typename Alloc>
+template <typename Predicate>
+unsigned int bi_ring<Key, Info, Alloc>::remove_if(Predicate pred) {
+	//every element is looked at once, from any onwards
+	unsigned int removed = 0;
+	Element* current = any;
+	for(unsigned int left = length; left; left--) {
+		Element* next = current -> next;
+		if(pred(static_cast<const Key&>(current -> key), static_cast<const Info&>(current -> info))) {
+			_erase(current);
+			removed++;
+		}
+		current = next;
+	}
+	return removed;
+}
+
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::remove_key(const Key& key) {
+	//index mode knows the occurrences already
+	if constexpr(is_hashable<Key>::value) {
+		if(lookup) {
+			auto found = lookup -> occurrences.find(key);
+			if(found == lookup -> occurrences.end()) {
+				return 0;
+			}
+			std::set<Element*, ByRank> filed = std::move(found -> second);
+			lookup -> occurrences.erase(found);
+			for(Element* item : filed) {
+				_erase(item);
+			}
+			return static_cast<unsigned int>(filed.size());
+		}
+	}
+	return remove_if([&key](const Key& current, const Info&) {
+		return current == key;
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::erase(iterator first, iterator last) {
+	if(!first.valid() || !last.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	if(first == last) {
+		return last;
+	}
+	if(first.current == last.current) {
+		purge();
+		return iterator();
+	}
+	//cut the range out at once, then free it node by node
+	Element* current = first.current;
+	current -> prev -> next = last.current;
+	last.current -> prev = current -> prev;
+	while(current != last.current) {
+		Element* next = current -> next;
+		if(current == any) {
+			any = last.current;
+		}
+		_index_erase(current);
+		_order_erase(current);
+		_destroy(current);
+		length--;
+		current = next;
+	}
+	return iterator(this, last.current);
+}
+
 /*
 	GETTER METHODS
 */
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::empty() const {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::empty() const {
 	return (any == nullptr && !length);
 }
 
-template<typename Key, typename Info>
-unsigned int bi_ring<Key, Info>::size() const {
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::size() const {
 	return length;
 }
 
-template<typename Key, typename Info>
-Info bi_ring<Key, Info>::get_info(const Key& key, int n_key) const {
+template<typename Key, typename Info, typename Alloc>
+const Info& bi_ring<Key, Info, Alloc>::get_info(const Key& key, int n_key) const {
 	//otherwise proceed to search
 	Element* result = _find(key, n_key);
 	if(result != nullptr) {
@@ -300,164 +642,1341 @@ Info bi_ring<Key, Info>::get_info(const Key& key, int n_key) const {
 	throw std::invalid_argument("Specified key not found");
 }
 
-template<typename Key, typename Info>
-void bi_ring<Key, Info>::print() const {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::find(const Key& key, int n_key) const {
+	//invalid iterator if there's no such occurrence
+	return const_iterator(this, _find(key, n_key));
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::find(const Key& key, int n_key) {
+	return iterator(this, _find(key, n_key));
+}
+
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::count(const Key& key) const {
+	if(empty()) {
+		return 0;
+	}
+	//index mode keeps every occurrence at hand
+	if constexpr(is_hashable<Key>::value) {
+		if(lookup) {
+			auto found = lookup -> occurrences.find(key);
+			return found == lookup -> occurrences.end() ? 0 : found -> second.size();
+		}
+	}
+	unsigned int n_ocr = 0;
+	Element* current = any;
+	do {
+		if(current -> key == key) {
+			n_ocr++;
+		}
+		current = current -> next;
+	} while(current != any);
+	return n_ocr;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::print() const {
 	//check if sequence is empty	
 	if(empty()) {
 		std::cout << "Ring empty!\n";
 		return;
 	}
-	//iterate through all elements printing
-	const_iterator itr(*this);
-	do {
-		std::cout << "Key ";
-		std::cout << itr.key() << ": ";
-		std::cout << itr.info() << std::endl;
-		itr++;
-	} while(itr != begin());
+	//iterate through all elements printing, flushing once at the end
+	text_output out(std::cout);
+	for(const_iterator itr = begin(); itr != end(); ++itr) {
+		out << "Key " << itr.key() << ": " << itr.info() << '\n';
+	}
+	out.flush();
+	std::cout.flush();
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::const_iterator
-bi_ring<Key, Info>::begin() const {
+template<typename Key, typename Info, typename Alloc>
+Alloc bi_ring<Key, Info, Alloc>::get_allocator() const {
+	return pool.get_allocator();
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::begin() const {
 	//construct new iterator to any pointer
 	return const_iterator(*this);
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::const_iterator
-bi_ring<Key, Info>::end() const {
-	//construct new iterator to before any
-	const_iterator end(*this);
-	--end;
-	return end;
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::end() const {
+	//any again, one lap on
+	return const_iterator(this, any, any ? 1 : 0);
+}
+
+/*
+	BULK METHODS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Function>
+void bi_ring<Key, Info, Alloc>::for_each(Function fn) {
+	_run_segments(nullptr, 1, [&](unsigned int, Element* current, unsigned int count) {
+		for(; count; count--, current = current -> next) {
+			fn(static_cast<const Key&>(current -> key), current -> info);
+		}
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Function>
+void bi_ring<Key, Info, Alloc>::transform_info(Function fn) {
+	_run_segments(nullptr, 1, [&](unsigned int, Element* current, unsigned int count) {
+		for(; count; count--, current = current -> next) {
+			current -> info = fn(static_cast<const Key&>(current -> key),
+					     static_cast<const Info&>(current -> info));
+		}
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Predicate>
+unsigned int bi_ring<Key, Info, Alloc>::count_if(Predicate pred) const {
+	unsigned int found = 0;
+	_run_segments(nullptr, 1, [&](unsigned int, const Element* current, unsigned int count) {
+		for(; count; count--, current = current -> next) {
+			found += pred(current -> key, current -> info) ? 1 : 0;
+		}
+	});
+	return found;
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Function>
+void bi_ring<Key, Info, Alloc>::for_each(thread_pool& workers, Function fn) {
+	_run_segments(&workers, _segment_count(&workers),
+		      [&](unsigned int, Element* current, unsigned int count) {
+		for(; count; count--, current = current -> next) {
+			fn(static_cast<const Key&>(current -> key), current -> info);
+		}
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Function>
+void bi_ring<Key, Info, Alloc>::transform_info(thread_pool& workers, Function fn) {
+	_run_segments(&workers, _segment_count(&workers),
+		      [&](unsigned int, Element* current, unsigned int count) {
+		for(; count; count--, current = current -> next) {
+			current -> info = fn(static_cast<const Key&>(current -> key),
+					     static_cast<const Info&>(current -> info));
+		}
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Predicate>
+unsigned int bi_ring<Key, Info, Alloc>::count_if(thread_pool& workers, Predicate pred) const {
+	unsigned int segments = _segment_count(&workers);
+	//per segment tallies, summed in order afterwards
+	std::vector<unsigned int> found(segments, 0);
+	_run_segments(&workers, segments, [&](unsigned int segment, const Element* current, unsigned int count) {
+		unsigned int tally = 0;
+		for(; count; count--, current = current -> next) {
+			tally += pred(current -> key, current -> info) ? 1 : 0;
+		}
+		found[segment] = tally;
+	});
+	unsigned int total = 0;
+	for(unsigned int tally : found) {
+		total += tally;
+	}
+	return total;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::clear_info(thread_pool& workers, const Info& filler) {
+	if(empty()) {
+		return false;
+	}
+	for_each(workers, [&](const Key&, Info& info) {
+		info = filler;
+	});
+	return true;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::equal(thread_pool& workers, const bi_ring<Key, Info, Alloc>& cmp) const {
+	if(this == &cmp) {
+		return true;
+	}
+	if(size() != cmp.size()) {
+		return false;
+	}
+	if(empty()) {
+		return true;
+	}
+	//equal lengths split into equal segments, so both rings walk in step
+	unsigned int segments = _segment_count(&workers);
+	std::shared_ptr<const Checkpoints> others = segments > 1 ? cmp._checkpoints(segments) : nullptr;
+	std::vector<char> same(segments, 1);
+	_run_segments(&workers, segments, [&](unsigned int segment, const Element* current, unsigned int count) {
+		const Element* other = others ? others -> starts[segment] : cmp.any;
+		for(; count; count--, current = current -> next, other = other -> next) {
+			if(*current != *other) {
+				same[segment] = 0;
+				return;
+			}
+		}
+	});
+	return std::find(same.begin(), same.end(), 0) == same.end();
 }
 
 /*
 	UTILITY METHODS
 */
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::clear_info(const Info& filler) {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::clear_info(const Info& filler) {
 	//check for empty list
 	if(empty()) {
 		return false;
 	}
 	//go through elements clearing info
-	iterator itr(*this);
-	do {
+	for(iterator itr(begin()); itr != end(); ++itr) {
 		itr.info() = filler;
-		itr++;
-	} while(itr != begin());
+	}
 	return true;
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::swap(iterator what, iterator dest) {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::swap(iterator what, iterator dest) {
 	//at least one of the iterators is invalid
 	if(!what.valid() || !dest.valid()) {
 		return false;
 	}
-	//swap payloads
-	Element temp = *(what.current);
-	what.key() = dest.key();
-	what.info() = dest.info();
-	dest.key() = temp.key;
-	dest.info() = temp.info;
+	//swap payloads, re-filing both elements if their keys differ
+	bool refile = !(what.key() == dest.key());
+	if(refile) {
+		_index_unfile(what.current);
+		_index_unfile(dest.current);
+	}
+	using std::swap;
+	swap(what.key(), dest.key());
+	swap(what.info(), dest.info());
+	if(refile) {
+		_index_file(what.current);
+		_index_file(dest.current);
+	}
 	return true;
 }
 
-/*
-	HELPERS
-*/
-
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::Element* 
-bi_ring<Key, Info>::_find(const Key& key, int n_key) const {
-	//check if argument is even valid
-	if(n_key < 1) {
-		throw std::invalid_argument("Key occurrence number cannot be negative");
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::swap_nodes(iterator what, iterator dest) {
+	//at least one of the iterators is invalid
+	if(!what.valid() || !dest.valid()) {
+		return false;
 	}
-	//check if there's where to search
-	if(empty()) {
-		return nullptr;
+	Element* first = what.current;
+	Element* secnd = dest.current;
+	if(first == secnd) {
+		return true;
 	}
-	//perform a search for target
-	Element* current = any;
-	int n_ocr = 0;
-	do {
-		if(current -> key == key) {
-			n_ocr++;
-		}
-		if(n_ocr == n_key) {
-			return current;
+	//both nodes trade ranks, filed again around the exchange
+	_index_unfile(first);
+	_index_unfile(secnd);
+	if(lookup) {
+		lookup -> ranks.exchange(first, secnd);
+	}
+	_order_erase(first);
+	_order_erase(secnd);
+	//two element ring only needs a new start
+	if(first -> next == secnd && secnd -> next == first) {
+	}
+	//neighbours, keep first in front of secnd
+	else if(first -> next == secnd || secnd -> next == first) {
+		if(secnd -> next == first) {
+			std::swap(first, secnd);
 		}
-		current = current -> next;
-	} while(current != any);
-	//give back empty search result if failed
-	return nullptr;
-}
-
-template<typename Key, typename Info> 
-bool bi_ring<Key, Info>::_clone(const bi_ring<Key, Info>& src) {
-	//sequences already equal or self-clone
-	if(this == &src || *this == src) {
-		return true;
+		Element* before = first -> prev;
+		Element* after = secnd -> next;
+		before -> next = secnd;
+		secnd -> prev = before;
+		secnd -> next = first;
+		first -> prev = secnd;
+		first -> next = after;
+		after -> prev = first;
 	}
-	//start cloning clean
-	if(!empty()) purge();
-	//iterate through source pushing content into this
-	const_iterator itr(src);
-	do {
-		push(itr.key(), itr.info());
-		itr++;
-	} while(itr != src.begin());
+	else {
+		first -> prev -> next = secnd;
+		first -> next -> prev = secnd;
+		secnd -> prev -> next = first;
+		secnd -> next -> prev = first;
+		std::swap(first -> prev, secnd -> prev);
+		std::swap(first -> next, secnd -> next);
+	}
+	revision++;
+	//any stays at the same ring position
+	if(any == what.current) {
+		any = dest.current;
+	}
+	else if(any == dest.current) {
+		any = what.current;
+	}
+	//a node is filed after its predecessor, so the front one goes first
+	if(what.current -> prev == dest.current && what.current != any) {
+		std::swap(what, dest);
+	}
+	_order_insert(what.current);
+	_order_insert(dest.current);
+	_index_file(what.current);
+	_index_file(dest.current);
 	return true;
 }
 
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::swap(bi_ring<Key, Info, Alloc>& other) {
+	//hand over the whole structure, pools follow the allocator rules
+	pool.swap(other.pool);
+	std::swap(any, other.any);
+	std::swap(length, other.length);
+	std::swap(lookup, other.lookup);
+	std::swap(order, other.order);
+	std::swap(revision, other.revision);
+	std::swap(checkpoints, other.checkpoints);
+	_trade_owner(other);
+}
+
 /*
-	ITERATORS
+	ORDERING METHODS
 */
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::const_iterator::const_iterator() {
-	current = nullptr;
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::sort() {
+	sort(std::less<Key>());
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::const_iterator::const_iterator(const bi_ring<Key, Info>& of) {
-	current = of.any;
+template<typename Key, typename Info, typename Alloc>
+template <typename Compare>
+void bi_ring<Key, Info, Alloc>::sort(Compare comp) {
+	if(length < 2) {
+		return;
+	}
+	//open the ring into a forward chain, closed again once sorted
+	Element* rest = any;
+	any -> prev -> next = nullptr;
+	//bin i holds a sorted run of 2^i elements, earlier elements in higher bins
+	Run bins[sizeof(unsigned int) * 8 + 1] = {};
+	Run sorted = {nullptr, nullptr};
+	try {
+		while(rest != nullptr) {
+			Run carry = {rest, rest};
+			rest = rest -> next;
+			carry.first -> next = nullptr;
+			unsigned int level = 0;
+			for(; bins[level].first != nullptr; level++) {
+				_merge(bins[level], carry, comp);
+				carry = bins[level];
+				bins[level] = Run();
+			}
+			bins[level] = carry;
+		}
+		for(Run& bin : bins) {
+			if(bin.first != nullptr) {
+				_merge(bin, sorted, comp);
+				sorted = bin;
+				bin = Run();
+			}
+		}
+	}
+	catch(...) {
+		//comp threw, keep every element in the ring, in no particular order
+		for(Run& bin : bins) {
+			if(bin.first != nullptr) {
+				Element* tail = bin.first;
+				while(tail -> next != nullptr) {
+					tail = tail -> next;
+				}
+				tail -> next = rest;
+				rest = bin.first;
+			}
+		}
+		_close(rest, _relink(rest));
+		throw;
+	}
+	_close(sorted.first, sorted.last);
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::const_iterator::const_iterator(const bi_ring<Key, Info>& of, 
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::merge(bi_ring<Key, Info, Alloc>&& other) {
+	merge(std::move(other), std::less<Key>());
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename Compare>
+void bi_ring<Key, Info, Alloc>::merge(bi_ring<Key, Info, Alloc>&& other, Compare comp) {
+	if(this == &other || other.empty()) {
+		return;
+	}
+	if(empty()) {
+		splice(iterator(), std::move(other));
+		return;
+	}
+	//take the nodes over behind the last element, then merge the two runs
+	Element* tail = any -> prev;
+	splice(iterator(this, any), std::move(other));
+	Run run = {any, tail};
+	Run taken = {tail -> next, any -> prev};
+	//other sorts entirely behind this ring, nothing to move
+	if(!comp(taken.first -> key, tail -> key)) {
+		return;
+	}
+	taken.last -> next = nullptr;
+	tail -> next = nullptr;
+	try {
+		_merge(run, taken, comp);
+	}
+	catch(...) {
+		_close(run.first, _relink(run.first));
+		throw;
+	}
+	_close(run.first, run.last);
+}
+
+/*
+	RESHAPING METHODS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> bi_ring<Key, Info, Alloc>::split(iterator at) {
+	if(!at.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	//the result shares only the blocks its nodes live in, held before
+	//anything is unfiled in case the block table has to grow
+	bi_ring<Key, Info, Alloc> tail(pool.get_allocator());
+	Element* first = at.current;
+	Element* last = any -> prev;
+	for(Element* current = first; current != any; current = current -> next) {
+		tail.pool.adopt(pool, current);
+	}
+	unsigned int count = 0;
+	for(Element* current = first; current != any; current = current -> next) {
+		_index_erase(current);
+		_order_erase(current);
+		count++;
+	}
+	//the whole ring leaves nothing behind, its pool goes along
+	if(first == any) {
+		count = length;
+		any = nullptr;
+		_index_clear();
+		if(order) {
+			order -> clear();
+		}
+		tail.pool.swap(pool);
+	}
+	else {
+		first -> prev -> next = any;
+		any -> prev = first -> prev;
+	}
+	length -= count;
+	revision++;
+	first -> prev = last;
+	last -> next = first;
+	tail.any = first;
+	tail.length = count;
+	return tail;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::rotate_to(iterator what) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	if(what.current == any) {
+		return;
+	}
+	if(order) {
+		order -> rotate(order -> position_of(what.current));
+	}
+	any = what.current;
+	revision++;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::reverse() {
+	if(length < 2) {
+		return;
+	}
+	Element* current = any;
+	do {
+		std::swap(current -> next, current -> prev);
+		//next holds the old prev now, the walk goes backwards
+		current = current -> next;
+	} while(current != any);
+	revision++;
+	_refile();
+}
+
+/*
+	INDEX METHODS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::enable_index() {
+	static_assert(is_hashable<Key>::value, "Index mode requires std::hash of the key type.");
+	if(lookup) {
+		return;
+	}
+	//rank and file every element in ring order, each lands last in its key
+	lookup.reset(new Index);
+	if(empty()) {
+		return;
+	}
+	unsigned int rank = 0;
+	Element* current = any;
+	do {
+		lookup -> ranks.insert(rank++, current);
+		std::set<Element*, ByRank>& filed = lookup -> occurrences.try_emplace(current -> key,
+									ByRank{&lookup -> ranks}).first -> second;
+		filed.insert(filed.end(), current);
+		current = current -> next;
+	} while(current != any);
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::disable_index() {
+	lookup.reset();
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::indexed() const {
+	return lookup != nullptr;
+}
+
+/*
+	POSITION METHODS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::enable_positions() {
+	if(order) {
+		return;
+	}
+	//number every element starting from any
+	order.reset(new position_index<Element*>);
+	if(empty()) {
+		return;
+	}
+	unsigned int pos = 0;
+	Element* current = any;
+	do {
+		order -> insert(pos++, current);
+		current = current -> next;
+	} while(current != any);
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::disable_positions() {
+	order.reset();
+}
+
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::positioned() const {
+	return order != nullptr;
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::at(unsigned int pos) const {
+	if(pos >= length) {
+		throw std::out_of_range("Position exceeds ring size.");
+	}
+	if(order) {
+		return const_iterator(this, order -> at(pos));
+	}
+	//walk from whichever side of any is closer
+	Element* current = any;
+	if(pos <= length / 2) {
+		for(unsigned int i = 0; i < pos; i++) {
+			current = current -> next;
+		}
+	}
+	else {
+		for(unsigned int i = pos; i < length; i++) {
+			current = current -> prev;
+		}
+	}
+	return const_iterator(this, current);
+}
+
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::position_of(const_iterator what) const {
+	if(!what.valid() || empty()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	if(order) {
+		return order -> position_of(what.current);
+	}
+	//count steps back to any
+	unsigned int pos = 0;
+	for(Element* current = what.current; current != any; current = current -> prev) {
+		pos++;
+	}
+	return pos;
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::advance(const_iterator what, int steps) const {
+	//no iterator is valid for an empty ring, one kept from before purge() included
+	if(!what.valid() || empty()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	//wrap the stride into a single lap forward
+	long long lap = static_cast<long long>(steps) % length;
+	unsigned int ahead = static_cast<unsigned int>(lap < 0 ? lap + length : lap);
+	if(order) {
+		unsigned int pos = order -> position_of(what.current) + ahead;
+		return const_iterator(this, order -> at(pos < length ? pos : pos - length));
+	}
+	//short strides stay local, going back if that is closer
+	if(ahead <= length / 2) {
+		for(unsigned int i = 0; i < ahead; i++) {
+			++what;
+		}
+	}
+	else {
+		for(unsigned int i = ahead; i < length; i++) {
+			--what;
+		}
+	}
+	return const_iterator(this, what.current);
+}
+
+/*
+	SERIALIZATION METHODS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::save(std::ostream& str) const {
+	using key_codec = ring_codec<Key>;
+	using info_codec = ring_codec<Info>;
+	ring_header header = {ring_header::signature, ring_header::current, 0,
+			      key_codec::tag, key_codec::size, info_codec::tag, info_codec::size, length};
+	str.write(reinterpret_cast<const char*>(&header), sizeof(header));
+	Element* current = any;
+	if constexpr(key_codec::raw && info_codec::raw) {
+		//records of key bytes then info bytes, a block of them per write
+		constexpr std::size_t record = sizeof(Key) + sizeof(Info);
+		std::vector<char> block(std::max<std::size_t>(1, (1 << 16) / record) * record);
+		std::size_t filled = 0;
+		for(unsigned int i = 0; i < length; i++) {
+			std::memcpy(&block[filled], &current -> key, sizeof(Key));
+			std::memcpy(&block[filled + sizeof(Key)], &current -> info, sizeof(Info));
+			filled += record;
+			if(filled == block.size()) {
+				str.write(block.data(), static_cast<std::streamsize>(filled));
+				filled = 0;
+			}
+			current = current -> next;
+		}
+		str.write(block.data(), static_cast<std::streamsize>(filled));
+	}
+	else {
+		for(unsigned int i = 0; i < length; i++) {
+			key_codec::write(str, current -> key);
+			info_codec::write(str, current -> info);
+			current = current -> next;
+		}
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::load(std::istream& str) {
+	using key_codec = ring_codec<Key>;
+	using info_codec = ring_codec<Info>;
+	ring_header header;
+	if(!str.read(reinterpret_cast<char*>(&header), sizeof(header))) {
+		throw std::invalid_argument("Truncated ring data.");
+	}
+	if(header.magic != ring_header::signature) {
+		throw std::invalid_argument("Not a saved ring.");
+	}
+	if(header.version != ring_header::current) {
+		throw std::invalid_argument("Unsupported ring data version.");
+	}
+	if(header.key_tag != key_codec::tag || header.key_size != key_codec::size ||
+	   header.info_tag != info_codec::tag || header.info_size != info_codec::size) {
+		throw std::invalid_argument("Saved ring holds other key or info types.");
+	}
+	if(header.count > std::numeric_limits<unsigned int>::max()) {
+		throw std::invalid_argument("Saved ring is too large.");
+	}
+	//build the chain aside, the ring is only replaced once all of it arrived
+	unsigned int count = static_cast<unsigned int>(header.count);
+	unsigned int built = 0;
+	Element* head = nullptr;
+	Element* tail = nullptr;
+	auto attach = [&](Element* node) {
+		if(tail != nullptr) {
+			tail -> next = node;
+		}
+		else {
+			head = node;
+		}
+		tail = node;
+		built++;
+	};
+	try {
+		if constexpr(key_codec::raw && info_codec::raw) {
+			//nodes are allocated a block at a time, as the data for them arrives
+			constexpr std::size_t record = sizeof(Key) + sizeof(Info);
+			const unsigned int per_block = static_cast<unsigned int>(std::max<std::size_t>(1, (1 << 16) / record));
+			std::vector<char> block(per_block * record);
+			while(built < count) {
+				unsigned int part = std::min(per_block, count - built);
+				if(!str.read(block.data(), static_cast<std::streamsize>(part * record))) {
+					throw std::invalid_argument("Truncated ring data.");
+				}
+				pool.reserve(part);
+				for(unsigned int i = 0; i < part; i++) {
+					Key key;
+					Info info;
+					std::memcpy(&key, &block[i * record], sizeof(Key));
+					std::memcpy(&info, &block[i * record + sizeof(Key)], sizeof(Info));
+					attach(_create(nullptr, tail, key, info));
+				}
+			}
+		}
+		else {
+			while(built < count) {
+				Key key = key_codec::read(str);
+				Info info = info_codec::read(str);
+				if(!str) {
+					throw std::invalid_argument("Truncated ring data.");
+				}
+				attach(_create(nullptr, tail, std::move(key), std::move(info)));
+			}
+		}
+	}
+	catch(...) {
+		_free_chain(head, tail);
+		throw;
+	}
+	purge();
+	if(built) {
+		_link(nullptr, head, tail, built);
+	}
+}
+
+/*
+	HELPERS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::Element* 
+bi_ring<Key, Info, Alloc>::_find(const Key& key, int n_key) const {
+	//check if argument is even valid
+	if(n_key < 1) {
+		throw std::invalid_argument("Key occurrence number cannot be negative");
+	}
+	//check if there's where to search
+	if(empty()) {
+		return nullptr;
+	}
+	//index mode, pick the occurrence straight away
+	if constexpr(is_hashable<Key>::value) {
+		if(lookup) {
+			auto found = lookup -> occurrences.find(key);
+			if(found == lookup -> occurrences.end() ||
+			   found -> second.size() < static_cast<unsigned int>(n_key)) {
+				return nullptr;
+			}
+			//a single occurrence needs no ordering
+			const std::set<Element*, ByRank>& filed = found -> second;
+			if(filed.size() == 1) {
+				return *filed.begin();
+			}
+			//occurrences run on from the first ranked at or behind any, wrapping around
+			auto current = filed.lower_bound(lookup -> ranks.position_of(any));
+			for(int n_ocr = 1; ; n_ocr++, ++current) {
+				if(current == filed.end()) {
+					current = filed.begin();
+				}
+				if(n_ocr == n_key) {
+					return *current;
+				}
+			}
+		}
+	}
+	//perform a search for target
+	Element* current = any;
+	int n_ocr = 0;
+	do {
+		if(current -> key == key) {
+			n_ocr++;
+		}
+		if(n_ocr == n_key) {
+			return current;
+		}
+		current = current -> next;
+	} while(current != any);
+	//give back empty search result if failed
+	return nullptr;
+}
+
+template<typename Key, typename Info, typename Alloc> 
+bool bi_ring<Key, Info, Alloc>::_clone(const bi_ring<Key, Info, Alloc>& src) {
+	//self-clone
+	if(this == &src) {
+		return true;
+	}
+	if(src.empty()) {
+		purge();
+		return true;
+	}
+	//a throwing copy leaves keys half overwritten, file what is there then
+	try {
+		//overwrite payloads of the nodes already in place
+		Element* from = src.any;
+		Element* dest = any;
+		unsigned int reused = std::min(length, src.length);
+		for(unsigned int i = 0; i < reused; i++) {
+			dest -> key = from -> key;
+			dest -> info = from -> info;
+			from = from -> next;
+			dest = dest -> next;
+		}
+		if(length > src.length) {
+			//cut off the surplus, dest is its first node
+			Element* tail = any -> prev;
+			dest -> prev -> next = any;
+			any -> prev = dest -> prev;
+			while(true) {
+				Element* next = dest -> next;
+				_destroy(dest);
+				if(dest == tail) {
+					break;
+				}
+				dest = next;
+			}
+			length = src.length;
+		}
+		else if(length < src.length) {
+			//rest is appended in one pass, out of a single block
+			pool.reserve(src.length - length);
+			while(length < src.length) {
+				Element* node = _create(nullptr, nullptr, from -> key, from -> info);
+				if(any == nullptr) {
+					node -> next = node;
+					node -> prev = node;
+					any = node;
+				}
+				else {
+					node -> next = any;
+					node -> prev = any -> prev;
+					any -> prev -> next = node;
+					any -> prev = node;
+				}
+				length++;
+				from = from -> next;
+			}
+		}
+	}
+	catch(...) {
+		_refile();
+		throw;
+	}
+	//keys changed wholesale, file them again
+	_refile();
+	return true;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_refile() {
+	if constexpr(is_hashable<Key>::value) {
+		if(lookup) {
+			lookup.reset();
+			enable_index();
+		}
+	}
+	if(order) {
+		order.reset();
+		enable_positions();
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_take(bi_ring<Key, Info, Alloc>& src) {
+	//clear itself
+	purge();
+	//nodes of src live in its pool, take it over
+	pool = std::move(src.pool);
+	lookup = std::move(src.lookup);
+	order = std::move(src.order);
+	//move ownership of src contents
+	any = src.any;
+	length = src.length;
+	revision++;
+	_trade_owner(src);
+	//disconnect source from its content
+	src.any = nullptr;
+	src.length = 0;
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_trade_owner(bi_ring<Key, Info, Alloc>& other) {
+	//iterators follow the elements to the ring now holding them
+	Owner* mine = owner.load(std::memory_order_relaxed);
+	Owner* theirs = other.owner.load(std::memory_order_relaxed);
+	owner.store(theirs, std::memory_order_relaxed);
+	other.owner.store(mine, std::memory_order_relaxed);
+	if(theirs != nullptr) {
+		theirs -> ring = this;
+	}
+	if(mine != nullptr) {
+		mine -> ring = &other;
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+const typename bi_ring<Key, Info, Alloc>::Owner* bi_ring<Key, Info, Alloc>::_owner() const {
+	//concurrent const passes may race to make it, only one is kept
+	Owner* made = owner.load(std::memory_order_acquire);
+	if(made == nullptr) {
+		Owner* fresh = new Owner{this};
+		if(owner.compare_exchange_strong(made, fresh, std::memory_order_acq_rel)) {
+			made = fresh;
+		}
+		else {
+			delete fresh;
+		}
+	}
+	return made;
+}
+
+template<typename Key, typename Info, typename Alloc>
+template <typename... Args>
+typename bi_ring<Key, Info, Alloc>::Element*
+bi_ring<Key, Info, Alloc>::_create(Element* next, Element* prev, Args&&... args) {
+	//construct in a pooled slot, give it back if construction throws
+	void* slot = pool.allocate();
+	revision++;
+	try {
+		return ::new (slot) Element(next, prev, std::forward<Args>(args)...);
+	}
+	catch(...) {
+		pool.deallocate(slot);
+		throw;
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_destroy(Element* item) {
+	revision++;
+	item -> ~Element();
+	pool.deallocate(item);
+}
+
+//links the range in before pos as one chain, returns its last element
+template<typename Key, typename Info, typename Alloc>
+template <typename InputIt>
+typename bi_ring<Key, Info, Alloc>::Element*
+bi_ring<Key, Info, Alloc>::_insert_range(Element* pos, InputIt first, InputIt last) {
+	using category = typename std::iterator_traits<InputIt>::iterator_category;
+	if constexpr(std::is_base_of<std::forward_iterator_tag, category>::value) {
+		pool.reserve(static_cast<unsigned int>(std::distance(first, last)));
+	}
+	//build the chain aside, the ring stays untouched until it is complete
+	Element* head = nullptr;
+	Element* tail = nullptr;
+	unsigned int count = 0;
+	try {
+		for(; first != last; ++first) {
+			auto&& item = *first;
+			Element* node = _create(nullptr, tail, std::forward<decltype(item)>(item).first,
+						std::forward<decltype(item)>(item).second);
+			if(tail != nullptr) {
+				tail -> next = node;
+			}
+			else {
+				head = node;
+			}
+			tail = node;
+			count++;
+		}
+	}
+	catch(...) {
+		_free_chain(head, tail);
+		throw;
+	}
+	if(count) {
+		_link(pos, head, tail, count);
+	}
+	return tail;
+}
+
+//frees a chain built aside that never made it into the ring
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_free_chain(Element* first, Element* last) {
+	while(first != nullptr) {
+		Element* next = first == last ? nullptr : first -> next;
+		_destroy(first);
+		first = next;
+	}
+}
+
+//unfiles, unlinks and frees a single element
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_erase(Element* item) {
+	_index_erase(item);
+	_order_erase(item);
+	if(item -> next == item) {
+		any = nullptr;
+	}
+	else {
+		item -> prev -> next = item -> next;
+		item -> next -> prev = item -> prev;
+		if(item == any) {
+			any = item -> next;
+		}
+	}
+	length--;
+	_destroy(item);
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_link(Element* pos, Element* first, Element* tail, unsigned int count) {
+	//chain first..tail becomes the whole ring or goes before pos
+	if(empty()) {
+		first -> prev = tail;
+		tail -> next = first;
+		any = first;
+	}
+	else {
+		first -> prev = pos -> prev;
+		tail -> next = pos;
+		pos -> prev -> next = first;
+		pos -> prev = tail;
+	}
+	length += count;
+	revision++;
+	if(!lookup && !order) {
+		return;
+	}
+	//counted, tail wraps around to first in a ring that was empty
+	Element* current = first;
+	for(unsigned int i = 0; i < count; i++) {
+		_order_insert(current);
+		_index_insert(current);
+		current = current -> next;
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_move_range(Element* pos, bi_ring<Key, Info, Alloc>& other,
+				    Element* first, Element* last) {
+	//move payloads one by one, first == last stands for the whole ring
+	iterator at(this, pos);
+	iterator current(&other, first);
+	do {
+		//unfile before the key is moved out
+		other._index_erase(current.current);
+		other._order_erase(current.current);
+		iterator moved = at.valid() ? emplace_before(at, std::move(current.key()), std::move(current.info()))
+					    : emplace(std::move(current.key()), std::move(current.info()));
+		at = at.valid() ? at : moved;
+		current = other.remove(current);
+	} while(current.valid() && current.current != last);
+}
+
+//merges sorted run other into sorted run into, on a throw into.first chains all of both
+template<typename Key, typename Info, typename Alloc>
+template <typename Compare>
+void bi_ring<Key, Info, Alloc>::_merge(Run& into, Run other, Compare& comp) {
+	Element* left = into.first;
+	Element* right = other.first;
+	Element* head = nullptr;
+	Element* last = nullptr;
+	Element** tail = &head;
+	try {
+		//ties are taken from the left, which keeps the merge stable
+		while(left != nullptr && right != nullptr) {
+			Element* taken;
+			if(comp(right -> key, left -> key)) {
+				taken = right;
+				right = right -> next;
+			}
+			else {
+				taken = left;
+				left = left -> next;
+			}
+			*tail = taken;
+			taken -> prev = last;
+			last = taken;
+			tail = &taken -> next;
+		}
+	}
+	catch(...) {
+		*tail = left;
+		while(*tail != nullptr) {
+			tail = &(*tail) -> next;
+		}
+		*tail = right;
+		into.first = head;
+		throw;
+	}
+	//prev links behind the first leftover are already in place
+	if(left != nullptr) {
+		*tail = left;
+		left -> prev = last;
+	}
+	else {
+		*tail = right;
+		right -> prev = last;
+		into.last = other.last;
+	}
+	into.first = head;
+}
+
+//restores prev links along the forward chain from first, returns its last element
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::Element*
+bi_ring<Key, Info, Alloc>::_relink(Element* first) {
+	Element* prev = first;
+	for(Element* current = first -> next; current != nullptr; current = current -> next) {
+		current -> prev = prev;
+		prev = current;
+	}
+	return prev;
+}
+
+//closes the chain first..last into the ring, first becoming any
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_close(Element* first, Element* last) {
+	last -> next = first;
+	first -> prev = last;
+	any = first;
+	revision++;
+	_refile();
+}
+
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::_segment_count(const thread_pool* workers) const {
+	//a few segments per thread even out their speeds, short ones are not worth a task
+	if(workers == nullptr || workers -> size() < 2) {
+		return 1;
+	}
+	return std::max(1u, std::min(workers -> size() * 4, length / min_segment));
+}
+
+template<typename Key, typename Info, typename Alloc>
+unsigned int bi_ring<Key, Info, Alloc>::_bound(unsigned int segment, unsigned int segments) const {
+	return static_cast<unsigned int>(static_cast<unsigned long long>(length) * segment / segments);
+}
+
+template<typename Key, typename Info, typename Alloc>
+std::shared_ptr<const typename bi_ring<Key, Info, Alloc>::Checkpoints>
+bi_ring<Key, Info, Alloc>::_checkpoints(unsigned int segments) const {
+	std::shared_ptr<const Checkpoints> cached = std::atomic_load(&checkpoints);
+	if(cached && cached -> revision == revision && cached -> starts.size() == segments) {
+		return cached;
+	}
+	//built aside, two passes racing here both build and one set wins
+	std::shared_ptr<Checkpoints> built = std::make_shared<Checkpoints>();
+	built -> revision = revision;
+	std::vector<Element*>& starts = built -> starts;
+	//position mode finds each start in O(log n), otherwise one walk finds them all
+	starts.resize(segments);
+	if(order) {
+		for(unsigned int segment = 0; segment < segments; segment++) {
+			starts[segment] = order -> at(_bound(segment, segments));
+		}
+	}
+	else {
+		Element* current = any;
+		unsigned int pos = 0;
+		for(unsigned int segment = 0; segment < segments; segment++) {
+			for(unsigned int bound = _bound(segment, segments); pos < bound; pos++) {
+				current = current -> next;
+			}
+			starts[segment] = current;
+		}
+	}
+	std::atomic_store(&checkpoints, std::shared_ptr<const Checkpoints>(built));
+	return built;
+}
+
+//calls visit(segment, first, count) for every segment, on workers when there are several
+template<typename Key, typename Info, typename Alloc>
+template <typename Visit>
+void bi_ring<Key, Info, Alloc>::_run_segments(thread_pool* workers, unsigned int segments, Visit visit) const {
+	if(empty()) {
+		return;
+	}
+	if(segments < 2) {
+		visit(0u, any, length);
+		return;
+	}
+	std::shared_ptr<const Checkpoints> marks = _checkpoints(segments);
+	const std::vector<Element*>& starts = marks -> starts;
+	workers -> run(segments, [&](unsigned int segment) {
+		visit(segment, starts[segment], _bound(segment + 1, segments) - _bound(segment, segments));
+	});
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_order_insert(Element* item) {
+	if(!order) {
+		return;
+	}
+	//elements other than any follow their predecessor
+	if(item == any) {
+		order -> insert(0, item);
+	}
+	else {
+		order -> insert(order -> position_of(item -> prev) + 1, item);
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_order_erase(Element* item) {
+	if(order) {
+		order -> erase(item);
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_index_insert(Element* item) {
+	if constexpr(is_hashable<Key>::value) {
+		if(!lookup) {
+			return;
+		}
+		//ranked right behind its predecessor, the only element anywhere
+		position_index<Element*>& ranks = lookup -> ranks;
+		ranks.insert(ranks.size() ? ranks.position_of(item -> prev) + 1 : 0, item);
+		_index_file(item);
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_index_erase(Element* item) {
+	if constexpr(is_hashable<Key>::value) {
+		//elements already taken out are skipped
+		if(!lookup || !lookup -> ranks.contains(item)) {
+			return;
+		}
+		_index_unfile(item);
+		lookup -> ranks.erase(item);
+	}
+}
+
+//adds a ranked element to the occurrences of its key
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_index_file(Element* item) {
+	if constexpr(is_hashable<Key>::value) {
+		if(!lookup) {
+			return;
+		}
+		std::set<Element*, ByRank>& filed = lookup -> occurrences.try_emplace(item -> key,
+								ByRank{&lookup -> ranks}).first -> second;
+		filed.insert(filed.lower_bound(lookup -> ranks.position_of(item)), item);
+	}
+}
+
+//takes a ranked element out of the occurrences of its key, keeping the rank
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_index_unfile(Element* item) {
+	if constexpr(is_hashable<Key>::value) {
+		if(!lookup) {
+			return;
+		}
+		auto found = lookup -> occurrences.find(item -> key);
+		if(found == lookup -> occurrences.end()) {
+			return;
+		}
+		std::set<Element*, ByRank>& filed = found -> second;
+		auto entry = filed.size() == 1 ? filed.begin() : filed.find(lookup -> ranks.position_of(item));
+		if(entry != filed.end() && *entry == item) {
+			filed.erase(entry);
+		}
+		if(filed.empty()) {
+			lookup -> occurrences.erase(found);
+		}
+	}
+}
+
+template<typename Key, typename Info, typename Alloc>
+void bi_ring<Key, Info, Alloc>::_index_clear() {
+	if constexpr(is_hashable<Key>::value) {
+		//occurrences go first, their ordering looks ranks up
+		if(lookup) {
+			lookup -> occurrences.clear();
+			lookup -> ranks.clear();
+		}
+	}
+}
+
+/*
+	ITERATORS
+*/
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::const_iterator::const_iterator() {
+	owner = nullptr;
+	current = nullptr;
+	lap = 0;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::const_iterator::const_iterator(const bi_ring<Key, Info, Alloc>& of) {
+	owner = of._owner();
+	current = of.any;
+	lap = 0;
+}
+
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::const_iterator::const_iterator(const bi_ring<Key, Info, Alloc>& of, 
 						   int key, int n_key) {
+	owner = of._owner();
 	current = of._find(key, n_key);
+	lap = 0;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::const_iterator::const_iterator(const const_iterator& src) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::const_iterator::const_iterator(const const_iterator& src) {
+	owner = src.owner;
 	current = src.current;
+	lap = src.lap;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::const_iterator::const_iterator(Element* at) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::const_iterator::const_iterator(const bi_ring<Key, Info, Alloc>* of,
+							 Element* at, int laps) {
+	owner = of -> _owner();
 	current = at;
+	lap = laps;
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key,Info>::const_iterator&
-bi_ring<Key, Info>::const_iterator::operator=(const const_iterator& src) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::const_iterator&
+bi_ring<Key, Info, Alloc>::const_iterator::operator=(const const_iterator& src) {
+	owner = src.owner;
 	current = src.current;
+	lap = src.lap;
 	return *this;
 }
 
-template<typename Key, typename Info>
+template<typename Key, typename Info, typename Alloc>
 //prefix
-typename bi_ring<Key, Info>::const_iterator& 
-bi_ring<Key, Info>::const_iterator::operator++() {
-	if(current != nullptr) {
+typename bi_ring<Key, Info, Alloc>::const_iterator& 
+bi_ring<Key, Info, Alloc>::const_iterator::operator++() {
+	if(!iterator_checks::enabled || current != nullptr) {
 		current = current -> next;
+		if(current == owner -> ring -> any) {
+			lap++;
+		}
 	}
 	else { 
 		throw std::domain_error(nulldef_exc);
@@ -465,10 +1984,10 @@ bi_ring<Key, Info>::const_iterator::operator++() {
 	return *this;
 }
 
-template<typename Key, typename Info>
+template<typename Key, typename Info, typename Alloc>
 //postfix
-typename bi_ring<Key, Info>::const_iterator
-bi_ring<Key, Info>::const_iterator::operator++(int ops) {
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::const_iterator::operator++(int ops) {
 	const_iterator prev(*this);
 	if(!ops) {
 		++(*this);
@@ -480,11 +1999,14 @@ bi_ring<Key, Info>::const_iterator::operator++(int ops) {
 	return prev;
 }
 
-template<typename Key, typename Info>
+template<typename Key, typename Info, typename Alloc>
 //prefix
-typename bi_ring<Key, Info>::const_iterator& 
-bi_ring<Key, Info>::const_iterator::operator--() {
-	if(current != nullptr) {
+typename bi_ring<Key, Info, Alloc>::const_iterator& 
+bi_ring<Key, Info, Alloc>::const_iterator::operator--() {
+	if(!iterator_checks::enabled || current != nullptr) {
+		if(current == owner -> ring -> any) {
+			lap--;
+		}
 		current = current -> prev;
 	}
 	else {
@@ -493,10 +2015,10 @@ bi_ring<Key, Info>::const_iterator::operator--() {
 	return *this;
 }
 
-template<typename Key, typename Info>
+template<typename Key, typename Info, typename Alloc>
 //postfix
-typename bi_ring<Key, Info>::const_iterator
-bi_ring<Key, Info>::const_iterator::operator--(int ops) {
+typename bi_ring<Key, Info, Alloc>::const_iterator
+bi_ring<Key, Info, Alloc>::const_iterator::operator--(int ops) {
 	const_iterator prev(*this);
 	if(!ops) {
 		--(*this);
@@ -508,9 +2030,9 @@ bi_ring<Key, Info>::const_iterator::operator--(int ops) {
 	return prev;
 }
 
-template<typename Key, typename Info>
-Info bi_ring<Key, Info>::const_iterator::operator*() const {
-	if(current != nullptr) {
+template<typename Key, typename Info, typename Alloc>
+const Info& bi_ring<Key, Info, Alloc>::const_iterator::operator*() const {
+	if(!iterator_checks::enabled || current != nullptr) {
 		return current -> info;
 	}
 	else {
@@ -518,19 +2040,19 @@ Info bi_ring<Key, Info>::const_iterator::operator*() const {
 	}
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::const_iterator::operator==(const const_iterator& cmp) const {
-	return current == cmp.current;
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::const_iterator::operator==(const const_iterator& cmp) const {
+	return current == cmp.current && lap == cmp.lap;
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::const_iterator::operator!=(const const_iterator& cmp) const {
-	return current != cmp.current;
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::const_iterator::operator!=(const const_iterator& cmp) const {
+	return !(*this == cmp);
 }
 
-template<typename Key, typename Info>
-Key bi_ring<Key, Info>::const_iterator::key() const {
-	if(current != nullptr) {
+template<typename Key, typename Info, typename Alloc>
+const Key& bi_ring<Key, Info, Alloc>::const_iterator::key() const {
+	if(!iterator_checks::enabled || current != nullptr) {
 		return current -> key;
 	}
 	else { 
@@ -538,9 +2060,9 @@ Key bi_ring<Key, Info>::const_iterator::key() const {
 	}
 }
 
-template<typename Key, typename Info>
-Info bi_ring<Key, Info>::const_iterator::info() const {
-	if(current != nullptr) {
+template<typename Key, typename Info, typename Alloc>
+const Info& bi_ring<Key, Info, Alloc>::const_iterator::info() const {
+	if(!iterator_checks::enabled || current != nullptr) {
 		return current -> info;
 	}
 	else {
@@ -548,24 +2070,52 @@ Info bi_ring<Key, Info>::const_iterator::info() const {
 	}
 }
 
-template<typename Key, typename Info>
-bool bi_ring<Key, Info>::const_iterator::valid() const {
+template<typename Key, typename Info, typename Alloc>
+bool bi_ring<Key, Info, Alloc>::const_iterator::valid() const {
 	return current != nullptr;
 }
 
-template<typename Key, typename Info>
-bi_ring<Key, Info>::iterator::iterator(const const_iterator& src) {
+template<typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc>::iterator::iterator(const const_iterator& src) {
+	iterator::owner = src.owner;
 	iterator::current = src.current;
+	iterator::lap = src.lap;
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator&
+bi_ring<Key, Info, Alloc>::iterator::operator++() {
+	const_iterator::operator++();
+	return *this;
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::iterator::operator++(int ops) {
+	return iterator(const_iterator::operator++(ops));
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator&
+bi_ring<Key, Info, Alloc>::iterator::operator--() {
+	const_iterator::operator--();
+	return *this;
+}
+
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::iterator::operator--(int ops) {
+	return iterator(const_iterator::operator--(ops));
 }
 
-template<typename Key, typename Info>
-Info& bi_ring<Key, Info>::iterator::operator*() {
+template<typename Key, typename Info, typename Alloc>
+Info& bi_ring<Key, Info, Alloc>::iterator::operator*() {
 	return info();
 }
 
-template<typename Key, typename Info>
-Key& bi_ring<Key, Info>::iterator::key() {
-	if(iterator::current != nullptr) {
+template<typename Key, typename Info, typename Alloc>
+Key& bi_ring<Key, Info, Alloc>::iterator::key() {
+	if(!iterator_checks::enabled || iterator::current != nullptr) {
 		return iterator::current -> key;
 	}
 	else {
@@ -573,9 +2123,9 @@ Key& bi_ring<Key, Info>::iterator::key() {
 	}
 }
 
-template<typename Key, typename Info>
-Info& bi_ring<Key, Info>::iterator::info() {
-	if(iterator::current != nullptr) {
+template<typename Key, typename Info, typename Alloc>
+Info& bi_ring<Key, Info, Alloc>::iterator::info() {
+	if(!iterator_checks::enabled || iterator::current != nullptr) {
 		return iterator::current -> info;
 	}
 	else {
@@ -583,47 +2133,54 @@ Info& bi_ring<Key, Info>::iterator::info() {
 	}
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::iterator::insert_after(const Key& key, const Info& inf) {
+template<typename Key, typename Info, typename Alloc>
+template <typename... Args>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::iterator::insert_after(bi_ring<Key, Info, Alloc>& parent,
+					   Args&&... args) {
 	Element* item = iterator::current;
 	//invalid iterator, abort
 	if(item == nullptr) {
 		throw std::domain_error(itrinvl_exc);
 	}
 	//insert after found element 
-	item -> next = new Element({key, inf, item -> next, item});
+	item -> next = parent._create(item -> next, item, std::forward<Args>(args)...);
 	//connect old successor back to new
 	item -> next -> next -> prev = item -> next;
 	//return iterator to new element
-	return iterator(item -> next);
+	return iterator(&parent, item -> next);
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::iterator::insert_before(const Key& key, const Info& inf) {
+template<typename Key, typename Info, typename Alloc>
+template <typename... Args>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::iterator::insert_before(bi_ring<Key, Info, Alloc>& parent,
+					    Args&&... args) {
 	if(!iterator::valid()) {
 		throw std::domain_error(itrinvl_exc);
 	}
 	//construct new iterator to element before current
-	iterator elementBefore(iterator::current -> prev);
+	iterator elementBefore(&parent, iterator::current -> prev);
 	//insert after previous element - before current
-	elementBefore = elementBefore.insert_after(key, inf);
+	elementBefore = elementBefore.insert_after(parent, std::forward<Args>(args)...);
 	return elementBefore;
 }
 
-template<typename Key, typename Info>
-typename bi_ring<Key, Info>::iterator
-bi_ring<Key, Info>::iterator::remove(bi_ring<Key, Info>& parent) {
+template<typename Key, typename Info, typename Alloc>
+typename bi_ring<Key, Info, Alloc>::iterator
+bi_ring<Key, Info, Alloc>::iterator::remove(bi_ring<Key, Info, Alloc>& parent) {
 	//invalid iterator, abort
 	if(!iterator::valid()) {
 		throw std::domain_error(nulldef_exc);
 	}
+	parent._index_erase(iterator::current);
+	parent._order_erase(iterator::current);
 	//check for one-element case
 	if(iterator::current -> next == iterator::current) {
-		delete parent.any;
+		parent._destroy(parent.any);
 		parent.any = nullptr;
 		iterator::current = nullptr;
+		iterator::lap = 0;
 		return *this;
 	}
 	//removing from multielement list
@@ -636,8 +2193,9 @@ bi_ring<Key, Info>::iterator::remove(bi_ring<Key, Info>& parent) {
 	//check for removing any
 	if(elementToBeDeleted == parent.any) {
 		parent.any = iterator::current;
+		iterator::lap = 0;
 	}
-	delete elementToBeDeleted;
+	parent._destroy(elementToBeDeleted);
 	return *this;
 }
 
@@ -645,9 +2203,14 @@ bi_ring<Key, Info>::iterator::remove(bi_ring<Key, Info>& parent) {
 	EXTERNAL FUNCTIONS
 */
 
-template <typename Key, typename Info>
-bi_ring<Key, Info> shuffle(const bi_ring<Key, Info>& first, unsigned int fcnt,
-			   const bi_ring<Key, Info>& secnd, unsigned int scnt,
+template <typename Key, typename Info, typename Alloc>
+void swap(bi_ring<Key, Info, Alloc>& first, bi_ring<Key, Info, Alloc>& secnd) {
+	first.swap(secnd);
+}
+
+template <typename Key, typename Info, typename Alloc>
+bi_ring<Key, Info, Alloc> shuffle(const bi_ring<Key, Info, Alloc>& first, unsigned int fcnt,
+			   const bi_ring<Key, Info, Alloc>& secnd, unsigned int scnt,
 			   unsigned int reps) {
 	//require two rings to be non-empty
 	if( !first.size() || !secnd.size() ) {
@@ -658,9 +2221,10 @@ bi_ring<Key, Info> shuffle(const bi_ring<Key, Info>& first, unsigned int fcnt,
 		throw std::invalid_argument("These count parameters result in no shuffling.");
 	}
 	//start shuffling
-	bi_ring<Key, Info> newRing;
-	typename bi_ring<Key, Info>::const_iterator itr_f(first);
-	typename bi_ring<Key, Info>::const_iterator itr_s(secnd);
+	bi_ring<Key, Info, Alloc> newRing(std::allocator_traits<Alloc>::
+		select_on_container_copy_construction(first.get_allocator()));
+	typename bi_ring<Key, Info, Alloc>::const_iterator itr_f(first);
+	typename bi_ring<Key, Info, Alloc>::const_iterator itr_s(secnd);
 	for(unsigned int i = 0; i < reps; i++) {
 		for(unsigned int j = 0; j < fcnt; j++) {
 			newRing.push(itr_f.key(), itr_f.info());
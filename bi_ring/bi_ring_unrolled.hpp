@@ -0,0 +1,240 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef UNROLLED_SEQUENCE_HPP
+#define UNROLLED_SEQUENCE_HPP
+
+//dependencies
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include "bi_ring.hpp"
+#include "key_scan.hpp"
+#include "node_pool.hpp"
+#include "text_output.hpp"
+
+/*
+	Bi-directional ring storing up to N key/info pairs per node.
+	Keys and infos of a node are kept in separate contiguous arrays,
+	so full traversals touch one node per N elements. Nodes are kept
+	at least half full by splits and merges, only the tail node may be
+	filled up gradually by push.
+	Elements move between slots as nodes change, so iterators, pointers
+	and references are only as stable as the node they point into. An
+	insertion shifts the rest of its node, or splits a full node in two,
+	invalidating those into the node it lands in; push invalidates none
+	while the tail node has room. A removal shifts the rest of its node
+	and may merge it with or refill it from a neighbour, invalidating
+	those into both nodes. Iterators into other nodes stay valid, as do
+	the ones insertion and removal give back.
+	Unlike bi_ring there is no Alloc parameter, nodes always come from
+	std::allocator through the node pool.
+*/
+template <typename Key, typename Info, unsigned int N = 16>
+class bi_ring_unrolled;
+template <typename Key, typename Info, unsigned int N>
+std::ostream& operator<<(std::ostream& str, const bi_ring_unrolled<Key, Info, N>& seq);
+
+template <typename Key, typename Info, unsigned int N>
+class bi_ring_unrolled {
+	static_assert(N >= 2, "Ring nodes need room for at least two elements.");
+public:
+	//(de)constructors
+	bi_ring_unrolled(); //DONE
+	bi_ring_unrolled(const Key& key, const Info& inf); //DONE
+	bi_ring_unrolled(const bi_ring_unrolled<Key, Info, N>& src); //DONE
+	bi_ring_unrolled(bi_ring_unrolled<Key, Info, N>&& src); //DONE
+	~bi_ring_unrolled(); //DONE
+
+	//operators
+	bool operator==(const bi_ring_unrolled<Key, Info, N>& cmp) const; //DONE
+	bool operator!=(const bi_ring_unrolled<Key, Info, N>& cmp) const; //DONE
+	bi_ring_unrolled<Key, Info, N>& operator=(const bi_ring_unrolled<Key, Info, N>& src); //DONE
+	bi_ring_unrolled<Key, Info, N>& operator=(bi_ring_unrolled<Key, Info, N>&& src); //DONE
+	bi_ring_unrolled<Key, Info, N> operator+(const bi_ring_unrolled<Key, Info, N>& src) const &; //DONE
+	bi_ring_unrolled<Key, Info, N> operator+(const bi_ring_unrolled<Key, Info, N>& src) &&; //DONE
+	bi_ring_unrolled<Key, Info, N> operator+(bi_ring_unrolled<Key, Info, N>&& src) const &; //DONE
+	bi_ring_unrolled<Key, Info, N> operator+(bi_ring_unrolled<Key, Info, N>&& src) &&; //DONE
+	bi_ring_unrolled<Key, Info, N>& operator+=(const bi_ring_unrolled<Key, Info, N>& src); //DONE
+	bi_ring_unrolled<Key, Info, N>& operator+=(bi_ring_unrolled<Key, Info, N>&& src); //DONE
+	friend std::ostream& operator<< <Key, Info, N>(std::ostream& str,
+				const bi_ring_unrolled<Key, Info, N>& seq); //DONE
+
+	//iterators, laps counted as for bi_ring, stay valid across swap() and moves
+	class const_iterator; //DONE
+	class iterator; //DONE
+
+	//insertion methods
+	iterator push(const Key& key, const Info& inf); //DONE
+	iterator push(Key key, Info&& inf); //DONE
+	iterator insert_after(const Key& key, const Info& inf,
+			      iterator what); //DONE
+	iterator insert_after(Key key, Info&& inf,
+			      iterator what); //DONE
+	iterator insert_before(const Key& key, const Info& inf,
+			       iterator what); //DONE
+	iterator insert_before(Key key, Info&& inf,
+			       iterator what); //DONE
+	bool replace(const Key& key, const Info& inf,
+		     iterator what); //DONE
+	bool replace(Key key, Info&& inf,
+		     iterator what); //DONE
+
+	//in-place insertion, key from key, info constructed from args
+	template <typename K, typename... Args>
+	iterator emplace(K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_after(iterator what, K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator emplace_before(iterator what, K&& key, Args&&... args); //DONE
+
+	//removal methods
+	bool purge(); //DONE
+	iterator remove_after(iterator what); //DONE
+	iterator remove_before(iterator what); //DONE
+	iterator remove(iterator what); //DONE
+
+	//getter methods
+	bool empty() const; //DONE
+	unsigned int size() const; //DONE
+	void print() const; //DONE
+	const Info& get_info(const Key& key, int n_key = 1) const; //DONE
+	const_iterator find(const Key& key, int n_key = 1) const; //DONE
+	iterator find(const Key& key, int n_key = 1); //DONE
+	unsigned int count(const Key& key) const; //DONE
+	const_iterator begin() const; //DONE
+	//past the last element, begin() one lap later
+	const_iterator end() const; //DONE
+
+	//utility methods
+	bool clear_info(const Info& filler); //DONE
+	bool swap(iterator what,
+		  iterator dest); //DONE
+	void swap(bi_ring_unrolled<Key, Info, N>& other); //DONE
+
+private:
+	//storage members
+	unsigned int length;
+	struct Chunk {
+		unsigned int count;
+		Chunk* next;
+		Chunk* prev;
+		alignas(Key) unsigned char key_store[N * sizeof(Key)];
+		alignas(Info) unsigned char info_store[N * sizeof(Info)];
+		Key* keys(); //DONE
+		Info* infos(); //DONE
+	};
+	Chunk* any;
+	node_pool<Chunk> pool;
+	//handle iterators reach the ring through, swap() and moves hand it
+	//over together with the elements
+	struct Owner {
+		const bi_ring_unrolled<Key, Info, N>* ring;
+	};
+	//made on first use, so empty rings allocate nothing
+	mutable std::atomic<Owner*> owner{nullptr};
+	//helper methods
+	const_iterator _find(const Key& key, int n_key = 1) const; //DONE
+	bool _clone(const bi_ring_unrolled<Key, Info, N>& src); //DONE
+	void _trade_owner(bi_ring_unrolled<Key, Info, N>& other); //DONE
+	const Owner* _owner() const; //DONE
+	Chunk* _create(Chunk* after); //DONE
+	void _destroy(Chunk* chunk); //DONE
+	void _relocate(Chunk* from, unsigned int at, Chunk* to, unsigned int dest); //DONE
+	void _open(Chunk* chunk, unsigned int at); //DONE
+	void _close(Chunk* chunk, unsigned int at); //DONE
+	template <typename K, typename... Args>
+	iterator _insert(Chunk* chunk, unsigned int at,
+			 K&& key, Args&&... args); //DONE
+	template <typename K, typename... Args>
+	iterator _place(Chunk* chunk, unsigned int at,
+			K&& key, Args&&... args); //DONE
+	iterator _erase(Chunk* chunk, unsigned int at); //DONE
+	void _rebalance(Chunk* chunk, const_iterator& track); //DONE
+};
+
+template <typename Key, typename Info, unsigned int N>
+class bi_ring_unrolled<Key, Info, N>::const_iterator {
+
+friend bi_ring_unrolled<Key, Info, N>;
+
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using value_type = Info;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Info*;
+	using reference = const Info&;
+
+	const_iterator(); //DONE
+	const_iterator(const bi_ring_unrolled<Key, Info, N>& of); //DONE
+	const_iterator(const const_iterator& src); //DONE
+	const_iterator(const bi_ring_unrolled<Key, Info, N>& of,
+		       const Key& key, int n_key = 1); //DONE
+
+	const_iterator& operator=(const const_iterator& src); //DONE
+	const_iterator& operator++();   //DONE
+	const_iterator operator++(int ops); //DONE
+	const_iterator& operator--();   //DONE
+	const_iterator operator--(int ops); //DONE
+	const Info& operator*() const;   //DONE
+	bool operator==(const const_iterator& itr) const; //DONE
+	bool operator!=(const const_iterator& itr) const; //DONE
+
+	//custom getters
+	const Key& key() const; //DONE
+	const Info& info() const; //DONE
+	bool valid() const; //DONE
+private:
+	//handle of the ring the iterator walks
+	const Owner* owner;
+	Chunk* current;
+	unsigned int index;
+	//times the first element was passed going forward, tells end() apart from begin()
+	int lap;
+	const_iterator(const bi_ring_unrolled<Key, Info, N>* of,
+		       Chunk* at, unsigned int idx, int laps = 0); //DONE
+};
+
+template <typename Key, typename Info, unsigned int N>
+class bi_ring_unrolled<Key, Info, N>::iterator
+	: public bi_ring_unrolled<Key, Info, N>::const_iterator {
+
+friend bi_ring_unrolled<Key, Info, N>;
+
+public:
+	using pointer = Info*;
+	using reference = Info&;
+
+	iterator(const const_iterator& src); //DONE
+	using const_iterator::const_iterator;
+
+	iterator& operator++();   //DONE
+	iterator operator++(int ops); //DONE
+	iterator& operator--();   //DONE
+	iterator operator--(int ops); //DONE
+	Info& operator*(); //DONE
+
+	//custom getters
+	Key& key(); //DONE
+	Info& info(); //DONE
+};
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N> shuffle(const bi_ring_unrolled<Key, Info, N>& first, unsigned int fcnt,
+				       const bi_ring_unrolled<Key, Info, N>& secnd, unsigned int scnt,
+				       unsigned int reps); //DONE
+
+template <typename Key, typename Info, unsigned int N>
+void swap(bi_ring_unrolled<Key, Info, N>& first, bi_ring_unrolled<Key, Info, N>& secnd); //DONE
+
+#include "bi_ring_unrolled_impl.hpp"
+
+#endif
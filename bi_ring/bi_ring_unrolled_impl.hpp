@@ -0,0 +1,1077 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+/*
+	CHUNK ACCESSORS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+Key* bi_ring_unrolled<Key, Info, N>::Chunk::keys() {
+	return std::launder(reinterpret_cast<Key*>(key_store));
+}
+
+template <typename Key, typename Info, unsigned int N>
+Info* bi_ring_unrolled<Key, Info, N>::Chunk::infos() {
+	return std::launder(reinterpret_cast<Info*>(info_store));
+}
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::bi_ring_unrolled() {
+	any = nullptr;
+	length = 0;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::bi_ring_unrolled(const Key& key, const Info& inf) {
+	any = nullptr;
+	length = 0;
+	//push initial first element
+	push(key, inf);
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::bi_ring_unrolled(const bi_ring_unrolled<Key, Info, N>& src) {
+	any = nullptr;
+	length = 0;
+	//run the clone helper on this object
+	_clone(src);
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::bi_ring_unrolled(bi_ring_unrolled<Key, Info, N>&& src)
+	: pool(std::move(src.pool)) {
+	//move src content ownership
+	any = src.any;
+	length = src.length;
+	_trade_owner(src);
+	//disconnect source from its content
+	src.any = nullptr;
+	src.length = 0;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::~bi_ring_unrolled() {
+	purge();
+	delete owner.load();
+}
+
+/*
+	OPERATORS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::operator==(const bi_ring_unrolled<Key, Info, N>& cmp) const {
+	//check for comparison to self
+	if(this == &cmp) {
+		return true;
+	}
+	//check lengths first
+	if(size() != cmp.size()) {
+		return false;
+	}
+	//both are empty, so equivalent
+	if(!size()) {
+		return true;
+	}
+	//node layouts may differ, compare the overlapping runs of both nodes
+	Chunk* chunk_t = any;
+	Chunk* chunk_c = cmp.any;
+	unsigned int idx_t = 0;
+	unsigned int idx_c = 0;
+	unsigned int left = length;
+	while(left) {
+		unsigned int run = std::min(chunk_t -> count - idx_t, chunk_c -> count - idx_c);
+		const Key* keys_t = chunk_t -> keys() + idx_t;
+		const Key* keys_c = chunk_c -> keys() + idx_c;
+		const Info* infos_t = chunk_t -> infos() + idx_t;
+		const Info* infos_c = chunk_c -> infos() + idx_c;
+		for(unsigned int i = 0; i < run; i++) {
+			if(!(keys_t[i] == keys_c[i] && infos_t[i] == infos_c[i])) {
+				return false;
+			}
+		}
+		left -= run;
+		idx_t += run;
+		idx_c += run;
+		if(idx_t == chunk_t -> count) {
+			chunk_t = chunk_t -> next;
+			idx_t = 0;
+		}
+		if(idx_c == chunk_c -> count) {
+			chunk_c = chunk_c -> next;
+			idx_c = 0;
+		}
+	}
+	//loop exited without mismatches
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::operator!=(const bi_ring_unrolled<Key, Info, N>& cmp) const {
+	return !(*this == cmp);
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>&
+bi_ring_unrolled<Key, Info, N>::operator=(const bi_ring_unrolled<Key, Info, N>& src) {
+	//clone helper checks every condition
+	_clone(src);
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>&
+bi_ring_unrolled<Key, Info, N>::operator=(bi_ring_unrolled<Key, Info, N>&& src) {
+	//check for self assign
+	if(this != &src) {
+		//clear itself
+		purge();
+		//nodes of src live in its pool, take it over
+		pool = std::move(src.pool);
+		//move ownership of src contents
+		any = src.any;
+		length = src.length;
+		_trade_owner(src);
+		//disconnect source from its content
+		src.any = nullptr;
+		src.length = 0;
+	}
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>
+bi_ring_unrolled<Key, Info, N>::operator+(const bi_ring_unrolled<Key, Info, N>& src) const & {
+	//if target ring is empty return unchanged
+	if(src.empty()) return *this;
+	//otherwise create new to return combined
+	bi_ring_unrolled<Key, Info, N> newRing(*this);
+	for(const_iterator itr = src.begin(); itr != src.end(); ++itr) {
+		newRing.push(itr.key(), itr.info());
+	}
+	return newRing;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>&
+bi_ring_unrolled<Key, Info, N>::operator+=(const bi_ring_unrolled<Key, Info, N>& src) {
+	//append copies of src only, self-append is snapshotted by the size
+	const_iterator itr(src);
+	unsigned int count = src.length;
+	for(unsigned int i = 0; i < count; i++) {
+		push(itr.key(), itr.info());
+		++itr;
+	}
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N> bi_ring_unrolled<Key, Info, N>::operator+(const bi_ring_unrolled<Key, Info, N>& src) && {
+	//reuse storage of the temporary
+	bi_ring_unrolled<Key, Info, N> newRing(std::move(*this));
+	newRing += src;
+	return newRing;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N> bi_ring_unrolled<Key, Info, N>::operator+(bi_ring_unrolled<Key, Info, N>&& src) const & {
+	bi_ring_unrolled<Key, Info, N> newRing(*this);
+	newRing += std::move(src);
+	return newRing;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N> bi_ring_unrolled<Key, Info, N>::operator+(bi_ring_unrolled<Key, Info, N>&& src) && {
+	bi_ring_unrolled<Key, Info, N> newRing(std::move(*this));
+	newRing += std::move(src);
+	return newRing;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>& bi_ring_unrolled<Key, Info, N>::operator+=(bi_ring_unrolled<Key, Info, N>&& src) {
+	if(this == &src) {
+		return *this += static_cast<const bi_ring_unrolled<Key, Info, N>&>(src);
+	}
+	//move payloads over, src is left empty
+	const_iterator itr(src);
+	for(unsigned int i = 0; i < src.length; i++) {
+		iterator from(itr);
+		push(std::move(from.key()), std::move(from.info()));
+		++itr;
+	}
+	src.purge();
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+std::ostream& operator<<(std::ostream& str, const bi_ring_unrolled<Key, Info, N>& seq) {
+	//formatted into a buffer, the stream sees a few large writes
+	text_output out(str);
+	for(auto itr = seq.begin(); itr != seq.end(); ++itr) {
+		out << '[' << itr.key()
+		<< "] " << itr.info() << '\n';
+	}
+	out.flush();
+	return str;
+}
+
+/*
+	INSERTION METHODS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::push(const Key& key, const Info& inf) {
+	return emplace(key, inf);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::push(Key key, Info&& inf) {
+	return emplace(std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::insert_after(const Key& key, const Info& inf,
+					     iterator what) {
+	return emplace_after(what, key, inf);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::insert_after(Key key, Info&& inf,
+					     iterator what) {
+	return emplace_after(what, std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::insert_before(const Key& key, const Info& inf,
+					      iterator what) {
+	return emplace_before(what, key, inf);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::insert_before(Key key, Info&& inf,
+					      iterator what) {
+	return emplace_before(what, std::move(key), std::move(inf));
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::replace(const Key& key, const Info& inf,
+					     iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	what.key() = key;
+	what.info() = inf;
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::replace(Key key, Info&& inf,
+					     iterator what) {
+	if(!what.valid()) {
+		return false;
+	}
+	what.key() = std::move(key);
+	what.info() = std::move(inf);
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+template <typename K, typename... Args>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::emplace(K&& key, Args&&... args) {
+	//first ring element case
+	if(empty()) {
+		any = _create(nullptr);
+		return _insert(any, 0, std::forward<K>(key), std::forward<Args>(args)...);
+	}
+	//append behind the last element, packing the tail node
+	Chunk* tail = any -> prev;
+	if(tail -> count == N) {
+		tail = _create(tail);
+	}
+	return _insert(tail, tail -> count, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Info, unsigned int N>
+template <typename K, typename... Args>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::emplace_after(iterator what, K&& key, Args&&... args) {
+	//invalid iterator, abort
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _insert(what.current, what.index + 1, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename Info, unsigned int N>
+template <typename K, typename... Args>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::emplace_before(iterator what, K&& key, Args&&... args) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	//insert after previous element - before current
+	--what;
+	return _insert(what.current, what.index + 1, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+/*
+	REMOVAL METHODS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::purge() {
+	//check if sequence is empty
+	if(empty()) {
+		return false;
+	}
+	//destroy every element, then deallocate its node
+	Chunk* current = any;
+	Chunk* next;
+	do {
+		next = current -> next;
+		for(unsigned int i = 0; i < current -> count; i++) {
+			current -> keys()[i].~Key();
+			current -> infos()[i].~Info();
+		}
+		current -> ~Chunk();
+		pool.deallocate(current);
+		current = next;
+	} while(current != any);
+	//mark sequence as empty again
+	any = nullptr;
+	length = 0;
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::remove_after(iterator what) {
+	//check if we even can do this
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	++what;
+	return _erase(what.current, what.index);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::remove_before(iterator what) {
+	//check if iterator is valid
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	--what;
+	return _erase(what.current, what.index);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::remove(iterator what) {
+	//check if iterator is valid
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	return _erase(what.current, what.index);
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::empty() const {
+	return (any == nullptr && !length);
+}
+
+template <typename Key, typename Info, unsigned int N>
+unsigned int bi_ring_unrolled<Key, Info, N>::size() const {
+	return length;
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::print() const {
+	//check if sequence is empty
+	if(empty()) {
+		std::cout << "Ring empty!\n";
+		return;
+	}
+	//iterate through all elements printing, flushing once at the end
+	text_output out(std::cout);
+	for(const_iterator itr = begin(); itr != end(); ++itr) {
+		out << "Key " << itr.key() << ": " << itr.info() << '\n';
+	}
+	out.flush();
+	std::cout.flush();
+}
+
+template <typename Key, typename Info, unsigned int N>
+const Info& bi_ring_unrolled<Key, Info, N>::get_info(const Key& key, int n_key) const {
+	const_iterator result = _find(key, n_key);
+	if(result.valid()) {
+		return result.info();
+	}
+	throw std::invalid_argument("Specified key not found");
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::find(const Key& key, int n_key) const {
+	//invalid iterator if there's no such occurrence
+	return _find(key, n_key);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::find(const Key& key, int n_key) {
+	return iterator(_find(key, n_key));
+}
+
+template <typename Key, typename Info, unsigned int N>
+unsigned int bi_ring_unrolled<Key, Info, N>::count(const Key& key) const {
+	if(empty()) {
+		return 0;
+	}
+	unsigned int n_ocr = 0;
+	Chunk* current = any;
+	do {
+		n_ocr += key_count(current -> keys(), current -> count, key);
+		current = current -> next;
+	} while(current != any);
+	return n_ocr;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::begin() const {
+	//construct new iterator to any pointer
+	return const_iterator(*this);
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::end() const {
+	//any again, one lap on
+	return const_iterator(this, any, 0, any ? 1 : 0);
+}
+
+/*
+	UTILITY METHODS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::clear_info(const Info& filler) {
+	//check for empty ring
+	if(empty()) {
+		return false;
+	}
+	//go through nodes clearing info arrays
+	Chunk* current = any;
+	do {
+		Info* infos = current -> infos();
+		for(unsigned int i = 0; i < current -> count; i++) {
+			infos[i] = filler;
+		}
+		current = current -> next;
+	} while(current != any);
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::swap(iterator what, iterator dest) {
+	//at least one of the iterators is invalid
+	if(!what.valid() || !dest.valid()) {
+		return false;
+	}
+	//swap payloads
+	using std::swap;
+	swap(what.key(), dest.key());
+	swap(what.info(), dest.info());
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::swap(bi_ring_unrolled<Key, Info, N>& other) {
+	//hand over the whole structure
+	pool.swap(other.pool);
+	std::swap(any, other.any);
+	std::swap(length, other.length);
+	_trade_owner(other);
+}
+
+/*
+	HELPERS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::_find(const Key& key, int n_key) const {
+	//check if argument is even valid
+	if(n_key < 1) {
+		throw std::invalid_argument("Key occurrence number cannot be negative");
+	}
+	//check if there's where to search
+	if(empty()) {
+		return const_iterator();
+	}
+	//scan key arrays node by node
+	Chunk* current = any;
+	unsigned int nth = n_key;
+	do {
+		unsigned int found = key_locate(current -> keys(), current -> count, key, nth);
+		if(found != current -> count) {
+			return const_iterator(this, current, found);
+		}
+		current = current -> next;
+	} while(current != any);
+	//give back empty search result if failed
+	return const_iterator();
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::_clone(const bi_ring_unrolled<Key, Info, N>& src) {
+	//self-clone
+	if(this == &src) {
+		return true;
+	}
+	//start cloning clean
+	if(!empty()) purge();
+	if(src.empty()) return true;
+	//copy node by node, keeping the source layout, out of a single block
+	unsigned int chunks = 0;
+	Chunk* current = src.any;
+	do {
+		chunks++;
+		current = current -> next;
+	} while(current != src.any);
+	pool.reserve(chunks);
+	do {
+		Chunk* copy = _create(empty() ? nullptr : any -> prev);
+		if(empty()) {
+			any = copy;
+		}
+		for(unsigned int i = 0; i < current -> count; i++) {
+			_insert(copy, i, current -> keys()[i], current -> infos()[i]);
+		}
+		current = current -> next;
+	} while(current != src.any);
+	return true;
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_trade_owner(bi_ring_unrolled<Key, Info, N>& other) {
+	//iterators follow the elements to the ring now holding them
+	Owner* mine = owner.load(std::memory_order_relaxed);
+	Owner* theirs = other.owner.load(std::memory_order_relaxed);
+	owner.store(theirs, std::memory_order_relaxed);
+	other.owner.store(mine, std::memory_order_relaxed);
+	if(theirs != nullptr) {
+		theirs -> ring = this;
+	}
+	if(mine != nullptr) {
+		mine -> ring = &other;
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+const typename bi_ring_unrolled<Key, Info, N>::Owner* bi_ring_unrolled<Key, Info, N>::_owner() const {
+	//concurrent const passes may race to make it, only one is kept
+	Owner* made = owner.load(std::memory_order_acquire);
+	if(made == nullptr) {
+		Owner* fresh = new Owner{this};
+		if(owner.compare_exchange_strong(made, fresh, std::memory_order_acq_rel)) {
+			made = fresh;
+		}
+		else {
+			delete fresh;
+		}
+	}
+	return made;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::Chunk*
+bi_ring_unrolled<Key, Info, N>::_create(Chunk* after) {
+	Chunk* chunk = ::new (pool.allocate()) Chunk;
+	chunk -> count = 0;
+	//first node links to itself
+	if(after == nullptr) {
+		chunk -> next = chunk;
+		chunk -> prev = chunk;
+		return chunk;
+	}
+	chunk -> next = after -> next;
+	chunk -> prev = after;
+	after -> next -> prev = chunk;
+	after -> next = chunk;
+	return chunk;
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_destroy(Chunk* chunk) {
+	//node must not hold any elements anymore
+	if(chunk -> next == chunk) {
+		any = nullptr;
+	}
+	else {
+		chunk -> prev -> next = chunk -> next;
+		chunk -> next -> prev = chunk -> prev;
+		if(chunk == any) {
+			any = chunk -> next;
+		}
+	}
+	chunk -> ~Chunk();
+	pool.deallocate(chunk);
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_relocate(Chunk* from, unsigned int at,
+					       Chunk* to, unsigned int dest) {
+	//move into an unoccupied slot, leaving the source slot unoccupied
+	Key* key = from -> keys() + at;
+	Info* info = from -> infos() + at;
+	::new (static_cast<void*>(to -> keys() + dest)) Key(std::move(*key));
+	::new (static_cast<void*>(to -> infos() + dest)) Info(std::move(*info));
+	key -> ~Key();
+	info -> ~Info();
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_open(Chunk* chunk, unsigned int at) {
+	//shift [at, count) one slot right, slot at becomes unoccupied
+	for(unsigned int i = chunk -> count; i > at; i--) {
+		_relocate(chunk, i - 1, chunk, i);
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_close(Chunk* chunk, unsigned int at) {
+	//shift (at, count) one slot left over the unoccupied slot at
+	for(unsigned int i = at + 1; i < chunk -> count; i++) {
+		_relocate(chunk, i, chunk, i - 1);
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+template <typename K, typename... Args>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::_insert(Chunk* chunk, unsigned int at,
+					K&& key, Args&&... args) {
+	//appending to a node with room constructs in place
+	if(chunk -> count < N && at == chunk -> count) {
+		return _place(chunk, at, std::forward<K>(key), std::forward<Args>(args)...);
+	}
+	//shifting moves elements, build payload first in case it refers to one of them
+	Key new_key(std::forward<K>(key));
+	Info new_info(std::forward<Args>(args)...);
+	//full node, split it in halves first
+	if(chunk -> count == N) {
+		Chunk* upper = _create(chunk);
+		unsigned int half = N / 2;
+		for(unsigned int i = half; i < N; i++) {
+			_relocate(chunk, i, upper, i - half);
+		}
+		upper -> count = N - half;
+		chunk -> count = half;
+		if(at > half) {
+			chunk = upper;
+			at -= half;
+		}
+	}
+	return _place(chunk, at, std::move(new_key), std::move(new_info));
+}
+
+template <typename Key, typename Info, unsigned int N>
+template <typename K, typename... Args>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::_place(Chunk* chunk, unsigned int at,
+				       K&& key, Args&&... args) {
+	//construct new element in the freed slot
+	_open(chunk, at);
+	try {
+		::new (static_cast<void*>(chunk -> keys() + at)) Key(std::forward<K>(key));
+		try {
+			::new (static_cast<void*>(chunk -> infos() + at)) Info(std::forward<Args>(args)...);
+		}
+		catch(...) {
+			chunk -> keys()[at].~Key();
+			throw;
+		}
+	}
+	catch(...) {
+		chunk -> count++;
+		_close(chunk, at);
+		chunk -> count--;
+		throw;
+	}
+	chunk -> count++;
+	length++;
+	return iterator(const_iterator(this, chunk, at));
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::_erase(Chunk* chunk, unsigned int at) {
+	chunk -> keys()[at].~Key();
+	chunk -> infos()[at].~Info();
+	_close(chunk, at);
+	chunk -> count--;
+	length--;
+	//remember the successor, then restore node occupancy around it
+	const_iterator track(this, chunk, at);
+	bool wrapped = at == chunk -> count && chunk -> next == any;
+	if(at == chunk -> count) {
+		track = const_iterator(this, chunk -> next, 0);
+	}
+	_rebalance(chunk, track);
+	//successor of the last element is end()
+	if(wrapped && track.valid()) {
+		track.lap = 1;
+	}
+	return iterator(track);
+}
+
+template <typename Key, typename Info, unsigned int N>
+void bi_ring_unrolled<Key, Info, N>::_rebalance(Chunk* chunk, const_iterator& track) {
+	//last node of the ring, only drop it once it is empty
+	if(chunk -> next == chunk) {
+		if(!chunk -> count) {
+			_destroy(chunk);
+			track = const_iterator();
+		}
+		return;
+	}
+	if(chunk -> count >= N / 2) {
+		return;
+	}
+	//pair with a neighbour without crossing the start of the ring
+	Chunk* left = chunk;
+	Chunk* right = chunk -> next;
+	if(right == any) {
+		left = chunk -> prev;
+		right = chunk;
+	}
+	unsigned int total = left -> count + right -> count;
+	//both fit in one node, merge right into left
+	if(total <= N) {
+		for(unsigned int i = 0; i < right -> count; i++) {
+			_relocate(right, i, left, left -> count + i);
+		}
+		if(track.current == right) {
+			track = const_iterator(this, left, left -> count + track.index);
+		}
+		left -> count = total;
+		right -> count = 0;
+		_destroy(right);
+		return;
+	}
+	//otherwise split the elements evenly
+	unsigned int target = total / 2;
+	if(left -> count < target) {
+		//move front of right to the back of left
+		unsigned int moved = target - left -> count;
+		for(unsigned int i = 0; i < moved; i++) {
+			_relocate(right, i, left, left -> count + i);
+		}
+		for(unsigned int i = moved; i < right -> count; i++) {
+			_relocate(right, i, right, i - moved);
+		}
+		if(track.current == right) {
+			track = track.index < moved
+				? const_iterator(this, left, left -> count + track.index)
+				: const_iterator(this, right, track.index - moved);
+		}
+		left -> count += moved;
+		right -> count -= moved;
+	}
+	else {
+		//move back of left to the front of right
+		unsigned int moved = left -> count - target;
+		for(unsigned int i = right -> count; i > 0; i--) {
+			_relocate(right, i - 1, right, i - 1 + moved);
+		}
+		for(unsigned int i = 0; i < moved; i++) {
+			_relocate(left, target + i, right, i);
+		}
+		if(track.current == right) {
+			track.index += moved;
+		}
+		else if(track.current == left && track.index >= target) {
+			track = const_iterator(this, right, track.index - target);
+		}
+		left -> count -= moved;
+		right -> count += moved;
+	}
+}
+
+/*
+	ITERATORS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::const_iterator::const_iterator() {
+	owner = nullptr;
+	current = nullptr;
+	index = 0;
+	lap = 0;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::const_iterator::const_iterator(const bi_ring_unrolled<Key, Info, N>& of) {
+	owner = of._owner();
+	current = of.any;
+	index = 0;
+	lap = 0;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::const_iterator::const_iterator(const bi_ring_unrolled<Key, Info, N>& of,
+							      const Key& key, int n_key) {
+	*this = of._find(key, n_key);
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::const_iterator::const_iterator(const const_iterator& src) {
+	owner = src.owner;
+	current = src.current;
+	index = src.index;
+	lap = src.lap;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::const_iterator::const_iterator(const bi_ring_unrolled<Key, Info, N>* of,
+							      Chunk* at, unsigned int idx, int laps) {
+	owner = of -> _owner();
+	current = at;
+	index = idx;
+	lap = laps;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::const_iterator&
+bi_ring_unrolled<Key, Info, N>::const_iterator::operator=(const const_iterator& src) {
+	owner = src.owner;
+	current = src.current;
+	index = src.index;
+	lap = src.lap;
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+//prefix
+typename bi_ring_unrolled<Key, Info, N>::const_iterator&
+bi_ring_unrolled<Key, Info, N>::const_iterator::operator++() {
+	if(iterator_checks::enabled && current == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	//step within the node, hop to the next one at its end
+	if(++index == current -> count) {
+		current = current -> next;
+		index = 0;
+		if(current == owner -> ring -> any) {
+			lap++;
+		}
+	}
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+//postfix
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::const_iterator::operator++(int ops) {
+	const_iterator prev(*this);
+	if(!ops) {
+		++(*this);
+		return prev;
+	}
+	for(int i = 0; i < ops; i++) {
+		++(*this);
+	}
+	return prev;
+}
+
+template <typename Key, typename Info, unsigned int N>
+//prefix
+typename bi_ring_unrolled<Key, Info, N>::const_iterator&
+bi_ring_unrolled<Key, Info, N>::const_iterator::operator--() {
+	if(iterator_checks::enabled && current == nullptr) {
+		throw std::domain_error(nulldef_exc);
+	}
+	//step within the node, hop to the end of the previous one
+	if(index == 0) {
+		if(current == owner -> ring -> any) {
+			lap--;
+		}
+		current = current -> prev;
+		index = current -> count;
+	}
+	index--;
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+//postfix
+typename bi_ring_unrolled<Key, Info, N>::const_iterator
+bi_ring_unrolled<Key, Info, N>::const_iterator::operator--(int ops) {
+	const_iterator prev(*this);
+	if(!ops) {
+		--(*this);
+		return prev;
+	}
+	for(int i = 0; i < ops; i++) {
+		--(*this);
+	}
+	return prev;
+}
+
+template <typename Key, typename Info, unsigned int N>
+const Info& bi_ring_unrolled<Key, Info, N>::const_iterator::operator*() const {
+	return info();
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::const_iterator::operator==(const const_iterator& cmp) const {
+	return current == cmp.current && index == cmp.index && lap == cmp.lap;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::const_iterator::operator!=(const const_iterator& cmp) const {
+	return !(*this == cmp);
+}
+
+template <typename Key, typename Info, unsigned int N>
+const Key& bi_ring_unrolled<Key, Info, N>::const_iterator::key() const {
+	if(!iterator_checks::enabled || current != nullptr) {
+		return current -> keys()[index];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+const Info& bi_ring_unrolled<Key, Info, N>::const_iterator::info() const {
+	if(!iterator_checks::enabled || current != nullptr) {
+		return current -> infos()[index];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+bool bi_ring_unrolled<Key, Info, N>::const_iterator::valid() const {
+	return current != nullptr;
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N>::iterator::iterator(const const_iterator& src) {
+	iterator::owner = src.owner;
+	iterator::current = src.current;
+	iterator::index = src.index;
+	iterator::lap = src.lap;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator&
+bi_ring_unrolled<Key, Info, N>::iterator::operator++() {
+	const_iterator::operator++();
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::iterator::operator++(int ops) {
+	return iterator(const_iterator::operator++(ops));
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator&
+bi_ring_unrolled<Key, Info, N>::iterator::operator--() {
+	const_iterator::operator--();
+	return *this;
+}
+
+template <typename Key, typename Info, unsigned int N>
+typename bi_ring_unrolled<Key, Info, N>::iterator
+bi_ring_unrolled<Key, Info, N>::iterator::operator--(int ops) {
+	return iterator(const_iterator::operator--(ops));
+}
+
+template <typename Key, typename Info, unsigned int N>
+Info& bi_ring_unrolled<Key, Info, N>::iterator::operator*() {
+	return info();
+}
+
+template <typename Key, typename Info, unsigned int N>
+Key& bi_ring_unrolled<Key, Info, N>::iterator::key() {
+	if(!iterator_checks::enabled || iterator::current != nullptr) {
+		return iterator::current -> keys()[iterator::index];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info, unsigned int N>
+Info& bi_ring_unrolled<Key, Info, N>::iterator::info() {
+	if(!iterator_checks::enabled || iterator::current != nullptr) {
+		return iterator::current -> infos()[iterator::index];
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+/*
+	EXTERNAL FUNCTIONS
+*/
+
+template <typename Key, typename Info, unsigned int N>
+void swap(bi_ring_unrolled<Key, Info, N>& first, bi_ring_unrolled<Key, Info, N>& secnd) {
+	first.swap(secnd);
+}
+
+template <typename Key, typename Info, unsigned int N>
+bi_ring_unrolled<Key, Info, N> shuffle(const bi_ring_unrolled<Key, Info, N>& first, unsigned int fcnt,
+				       const bi_ring_unrolled<Key, Info, N>& secnd, unsigned int scnt,
+				       unsigned int reps) {
+	//require two rings to be non-empty
+	if( !first.size() || !secnd.size() ) {
+		throw std::invalid_argument("One of the rings is empty.");
+	}
+	//require parameters to be non-zero
+	if( !fcnt || !scnt || !reps ) {
+		throw std::invalid_argument("These count parameters result in no shuffling.");
+	}
+	//start shuffling
+	bi_ring_unrolled<Key, Info, N> newRing;
+	typename bi_ring_unrolled<Key, Info, N>::const_iterator itr_f(first);
+	typename bi_ring_unrolled<Key, Info, N>::const_iterator itr_s(secnd);
+	for(unsigned int i = 0; i < reps; i++) {
+		for(unsigned int j = 0; j < fcnt; j++) {
+			newRing.push(itr_f.key(), itr_f.info());
+			itr_f++;
+		}
+		for(unsigned int j = 0; j < scnt; j++) {
+			newRing.push(itr_s.key(), itr_s.info());
+			itr_s++;
+		}
+	}
+	//everything succeeded, return shuffled result
+	return newRing;
+}
@@ -0,0 +1,466 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef CONCURRENT_RING_HPP
+#define CONCURRENT_RING_HPP
+
+//dependencies
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include "bi_ring.hpp"
+
+/*
+	Bi-directional ring shared between threads, locked per element.
+	Every element and the sentinel closing the ring carry their own
+	mutex, so operations on disjoint parts of the ring run in parallel.
+	Searches lock hand-over-hand from the sentinel onwards, insertions
+	and removals lock only the elements whose links they change.
+	Locks are waited for in ring order from the sentinel, anything
+	against that order is only tried and the operation backs off and
+	retries when it fails, which keeps the ring free of deadlocks.
+	Every element counts the iterators pinning it next to the pin of the
+	ring itself, a removed element is freed as soon as the last iterator
+	to it lets go, so iterators stay safe to pass around between threads
+	while the ring is in use and memory is handed back as it goes.
+*/
+template <typename Key, typename Info>
+class concurrent_bi_ring {
+public:
+	//(de)constructors
+	concurrent_bi_ring(); //DONE
+	concurrent_bi_ring(const concurrent_bi_ring<Key, Info>& src) = delete;
+	~concurrent_bi_ring(); //DONE
+
+	//operators
+	concurrent_bi_ring<Key, Info>& operator=(const concurrent_bi_ring<Key, Info>& src) = delete;
+
+	//iterators
+	class iterator; //DONE
+
+	//insertion methods
+	iterator push(const Key& key, const Info& inf); //DONE
+	//invalid iterator when what was removed meanwhile
+	iterator insert_after(const Key& key, const Info& inf,
+			      iterator what); //DONE
+
+	//removal methods
+	//false when what was removed already, freed once no iterator pins it
+	bool remove(iterator what); //DONE
+
+	//getter methods
+	bool empty() const; //DONE
+	unsigned int size() const; //DONE
+	Info get_info(const Key& key, int n_key = 1) const; //DONE
+	iterator find(const Key& key, int n_key = 1) const; //DONE
+	unsigned int count(const Key& key) const; //DONE
+
+	//access methods, fn runs under the lock of the element
+	template <typename Function>
+	bool update(iterator what, Function fn); //DONE
+	template <typename Function>
+	void for_each(Function fn); //DONE
+
+private:
+	struct Link {
+		Link* next;
+		Link* prev;
+		std::mutex lock;
+		bool removed = false;
+	};
+	struct Element : Link {
+		Key key;
+		Info info;
+		//one for the ring while linked, one per iterator
+		std::atomic<unsigned int> pins;
+		Element(const Key& key, const Info& info)
+			: key(key), info(info), pins(1) {
+		}
+	};
+	//storage members
+	mutable Link head;
+	std::atomic<unsigned int> length;
+	//helper methods
+	void _link(Link* pred, Link* succ, Element* item); //DONE
+	static void _unpin(Element* item); //DONE
+	static void _back_off(); //DONE
+	template <typename Visit>
+	void _walk(Visit visit) const; //DONE
+};
+
+template <typename Key, typename Info>
+class concurrent_bi_ring<Key, Info>::iterator {
+
+friend concurrent_bi_ring<Key, Info>;
+
+public:
+	iterator(); //DONE
+	iterator(const iterator& src); //DONE
+	~iterator(); //DONE
+
+	iterator& operator=(const iterator& src); //DONE
+	bool operator==(const iterator& itr) const; //DONE
+	bool operator!=(const iterator& itr) const; //DONE
+
+	//custom getters, keys never change once inserted
+	const Key& key() const; //DONE
+	bool valid() const; //DONE
+private:
+	Element* current;
+	//pins at, which has to be linked or pinned already
+	explicit iterator(Element* at); //DONE
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::concurrent_bi_ring()
+	: length(0) {
+	head.next = &head;
+	head.prev = &head;
+}
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::~concurrent_bi_ring() {
+	//elements still pinned by iterators outlive the ring
+	Link* item = head.next;
+	while(item != &head) {
+		Link* next = item -> next;
+		_unpin(static_cast<Element*>(item));
+		item = next;
+	}
+}
+
+/*
+	INSERTION METHODS
+*/
+
+template <typename Key, typename Info>
+typename concurrent_bi_ring<Key, Info>::iterator
+concurrent_bi_ring<Key, Info>::push(const Key& key, const Info& inf) {
+	Element* item = new Element(key, inf);
+	//pinned before it is linked, another thread may remove it right away
+	iterator result(item);
+	while(true) {
+		//the sentinel comes first in the order, the last element is only tried
+		head.lock.lock();
+		Link* last = head.prev;
+		if(last == &head) {
+			_link(&head, &head, item);
+			head.lock.unlock();
+			break;
+		}
+		if(last -> lock.try_lock()) {
+			_link(last, &head, item);
+			last -> lock.unlock();
+			head.lock.unlock();
+			break;
+		}
+		head.lock.unlock();
+		_back_off();
+	}
+	return result;
+}
+
+template <typename Key, typename Info>
+typename concurrent_bi_ring<Key, Info>::iterator
+concurrent_bi_ring<Key, Info>::insert_after(const Key& key, const Info& inf,
+					    iterator what) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	iterator result;
+	while(true) {
+		what.current -> lock.lock();
+		if(what.current -> removed) {
+			what.current -> lock.unlock();
+			//never linked, the ring lets go of it
+			if(result.valid()) {
+				_unpin(result.current);
+			}
+			return iterator();
+		}
+		//pinned before it is linked, another thread may remove it right away
+		if(!result.valid()) {
+			result = iterator(new Element(key, inf));
+		}
+		Link* succ = what.current -> next;
+		//waiting is fine going forward, wrapping onto the sentinel is not
+		if(succ != &head) {
+			succ -> lock.lock();
+		}
+		else if(!succ -> lock.try_lock()) {
+			what.current -> lock.unlock();
+			_back_off();
+			continue;
+		}
+		_link(what.current, succ, result.current);
+		succ -> lock.unlock();
+		what.current -> lock.unlock();
+		return result;
+	}
+}
+
+/*
+	REMOVAL METHODS
+*/
+
+template <typename Key, typename Info>
+bool concurrent_bi_ring<Key, Info>::remove(iterator what) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	Element* item = what.current;
+	while(true) {
+		item -> lock.lock();
+		if(item -> removed) {
+			item -> lock.unlock();
+			return false;
+		}
+		//the predecessor lies against the order, so it is only tried
+		Link* pred = item -> prev;
+		if(!pred -> lock.try_lock()) {
+			item -> lock.unlock();
+			_back_off();
+			continue;
+		}
+		Link* succ = item -> next;
+		if(succ == &head && pred != &head) {
+			if(!head.lock.try_lock()) {
+				pred -> lock.unlock();
+				item -> lock.unlock();
+				_back_off();
+				continue;
+			}
+		}
+		else if(succ != &head) {
+			succ -> lock.lock();
+		}
+		pred -> next = succ;
+		succ -> prev = pred;
+		item -> removed = true;
+		length--;
+		if(succ != pred) {
+			succ -> lock.unlock();
+		}
+		pred -> lock.unlock();
+		item -> lock.unlock();
+		break;
+	}
+	//what still pins it, the last iterator to let go frees it
+	_unpin(item);
+	return true;
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Key, typename Info>
+bool concurrent_bi_ring<Key, Info>::empty() const {
+	return !length;
+}
+
+template <typename Key, typename Info>
+unsigned int concurrent_bi_ring<Key, Info>::size() const {
+	return length;
+}
+
+template <typename Key, typename Info>
+Info concurrent_bi_ring<Key, Info>::get_info(const Key& key, int n_key) const {
+	if(n_key < 1) {
+		throw std::invalid_argument("Specified key not found");
+	}
+	//copied out while the element is still locked
+	Info result{};
+	bool found = false;
+	_walk([&](Element* item) {
+		if(item -> key == key && !--n_key) {
+			result = item -> info;
+			found = true;
+		}
+		return !found;
+	});
+	if(!found) {
+		throw std::invalid_argument("Specified key not found");
+	}
+	return result;
+}
+
+template <typename Key, typename Info>
+typename concurrent_bi_ring<Key, Info>::iterator
+concurrent_bi_ring<Key, Info>::find(const Key& key, int n_key) const {
+	iterator result;
+	if(n_key < 1) {
+		return result;
+	}
+	//pinned while still locked, it may be removed right after
+	_walk([&](Element* item) {
+		if(item -> key == key && !--n_key) {
+			result = iterator(item);
+		}
+		return !result.valid();
+	});
+	return result;
+}
+
+template <typename Key, typename Info>
+unsigned int concurrent_bi_ring<Key, Info>::count(const Key& key) const {
+	unsigned int total = 0;
+	_walk([&](Element* item) {
+		total += item -> key == key;
+		return true;
+	});
+	return total;
+}
+
+/*
+	ACCESS METHODS
+*/
+
+template <typename Key, typename Info>
+template <typename Function>
+bool concurrent_bi_ring<Key, Info>::update(iterator what, Function fn) {
+	if(!what.valid()) {
+		throw std::domain_error(itrinvl_exc);
+	}
+	std::lock_guard<std::mutex> guard(what.current -> lock);
+	if(what.current -> removed) {
+		return false;
+	}
+	fn(what.current -> info);
+	return true;
+}
+
+template <typename Key, typename Info>
+template <typename Function>
+void concurrent_bi_ring<Key, Info>::for_each(Function fn) {
+	_walk([&](Element* item) {
+		fn(static_cast<const Key&>(item -> key), item -> info);
+		return true;
+	});
+}
+
+/*
+	HELPER METHODS
+*/
+
+//links item between pred and succ, both locked by the caller
+template <typename Key, typename Info>
+void concurrent_bi_ring<Key, Info>::_link(Link* pred, Link* succ, Element* item) {
+	item -> prev = pred;
+	item -> next = succ;
+	pred -> next = item;
+	succ -> prev = item;
+	length++;
+}
+
+//frees item once nothing pins it any more
+template <typename Key, typename Info>
+void concurrent_bi_ring<Key, Info>::_unpin(Element* item) {
+	if(item -> pins.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+		delete item;
+	}
+}
+
+template <typename Key, typename Info>
+void concurrent_bi_ring<Key, Info>::_back_off() {
+	std::this_thread::yield();
+}
+
+//hand-over-hand walk from the sentinel, visit runs with the element locked
+//and returns false to stop, the sentinel is never locked again at the end
+template <typename Key, typename Info>
+template <typename Visit>
+void concurrent_bi_ring<Key, Info>::_walk(Visit visit) const {
+	Link* held = &head;
+	held -> lock.lock();
+	Link* item = held -> next;
+	while(item != &head) {
+		item -> lock.lock();
+		held -> lock.unlock();
+		held = item;
+		if(!visit(static_cast<Element*>(item))) {
+			break;
+		}
+		item = item -> next;
+	}
+	held -> lock.unlock();
+}
+
+/*
+	ITERATOR
+*/
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::iterator::iterator()
+	: current(nullptr) {
+}
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::iterator::iterator(const iterator& src)
+	: iterator(src.current) {
+}
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::iterator::iterator(Element* at)
+	: current(at) {
+	if(current != nullptr) {
+		current -> pins.fetch_add(1, std::memory_order_relaxed);
+	}
+}
+
+template <typename Key, typename Info>
+concurrent_bi_ring<Key, Info>::iterator::~iterator() {
+	if(current != nullptr) {
+		_unpin(current);
+	}
+}
+
+template <typename Key, typename Info>
+typename concurrent_bi_ring<Key, Info>::iterator&
+concurrent_bi_ring<Key, Info>::iterator::operator=(const iterator& src) {
+	//pin the new element first, src may be the last iterator to the old one
+	if(src.current != nullptr) {
+		src.current -> pins.fetch_add(1, std::memory_order_relaxed);
+	}
+	if(current != nullptr) {
+		_unpin(current);
+	}
+	current = src.current;
+	return *this;
+}
+
+template <typename Key, typename Info>
+bool concurrent_bi_ring<Key, Info>::iterator::operator==(const iterator& itr) const {
+	return current == itr.current;
+}
+
+template <typename Key, typename Info>
+bool concurrent_bi_ring<Key, Info>::iterator::operator!=(const iterator& itr) const {
+	return !(*this == itr);
+}
+
+template <typename Key, typename Info>
+const Key& concurrent_bi_ring<Key, Info>::iterator::key() const {
+	if(!iterator_checks::enabled || current != nullptr) {
+		return current -> key;
+	}
+	else {
+		throw std::domain_error(nulldef_exc);
+	}
+}
+
+template <typename Key, typename Info>
+bool concurrent_bi_ring<Key, Info>::iterator::valid() const {
+	return current != nullptr;
+}
+
+#endif
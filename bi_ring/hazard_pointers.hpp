@@ -0,0 +1,171 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef HAZARD_POINTERS_HPP
+#define HAZARD_POINTERS_HPP
+
+//dependencies
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/*
+	Hazard pointers for lock-free structures sharing nodes between threads.
+	A thread publishes every node it is about to read in one of its slots,
+	and a node handed to retire() is only freed once no slot holds it.
+	Slot records are claimed on first use and handed back when the thread
+	exits, retired nodes are scanned for in batches proportional to the
+	number of records, so freeing stays amortized O(1) per node. Nodes
+	still held when their thread exits are left to the next scan of
+	any other thread.
+*/
+class hazard_pointers {
+public:
+	static constexpr unsigned int per_thread = 2;
+
+	//publishes the pointer loaded from src in slot and returns it once stable
+	template <typename T>
+	static T* protect(unsigned int slot, const std::atomic<T*>& src);
+	static void clear(unsigned int slot);
+	//frees node with deleter once no thread protects it
+	static void retire(void* node, void (*deleter)(void*));
+
+private:
+	struct Record {
+		Record* next;
+		std::atomic<bool> active;
+		std::atomic<void*> slots[per_thread];
+	};
+	struct Retired {
+		void* node;
+		void (*deleter)(void*);
+	};
+	struct Local {
+		Record* record;
+		std::vector<Retired> retired;
+		Local();
+		~Local();
+	};
+	//storage members
+	static inline std::atomic<Record*> records{nullptr};
+	static inline std::atomic<unsigned int> count{0};
+	static inline std::mutex orphan_lock;
+	static inline std::vector<Retired> orphans;
+	//helper methods
+	static Local& _local();
+	static void _scan(std::vector<Retired>& retired);
+};
+
+/*
+	SLOT MANAGEMENT
+*/
+
+template <typename T>
+T* hazard_pointers::protect(unsigned int slot, const std::atomic<T*>& src) {
+	std::atomic<void*>& hazard = _local().record -> slots[slot];
+	T* seen = src.load(std::memory_order_relaxed);
+	while(true) {
+		hazard.store(seen, std::memory_order_seq_cst);
+		//src may have moved on and its node been freed before the slot was seen
+		T* again = src.load(std::memory_order_seq_cst);
+		if(again == seen) {
+			return seen;
+		}
+		seen = again;
+	}
+}
+
+inline void hazard_pointers::clear(unsigned int slot) {
+	_local().record -> slots[slot].store(nullptr, std::memory_order_release);
+}
+
+inline void hazard_pointers::retire(void* node, void (*deleter)(void*)) {
+	Local& local = _local();
+	local.retired.push_back({node, deleter});
+	if(local.retired.size() >= 2 * per_thread * count.load(std::memory_order_relaxed) + 16) {
+		_scan(local.retired);
+	}
+}
+
+/*
+	HELPER METHODS
+*/
+
+inline hazard_pointers::Local::Local() {
+	//reuse a record of an exited thread before adding one
+	for(record = records.load(std::memory_order_acquire); record; record = record -> next) {
+		bool idle = false;
+		if(record -> active.compare_exchange_strong(idle, true)) {
+			return;
+		}
+	}
+	record = new Record;
+	record -> active.store(true, std::memory_order_relaxed);
+	for(std::atomic<void*>& slot : record -> slots) {
+		slot.store(nullptr, std::memory_order_relaxed);
+	}
+	record -> next = records.load(std::memory_order_relaxed);
+	while(!records.compare_exchange_weak(record -> next, record, std::memory_order_release,
+					     std::memory_order_relaxed)) {
+	}
+	count.fetch_add(1, std::memory_order_relaxed);
+}
+
+inline hazard_pointers::Local::~Local() {
+	for(std::atomic<void*>& slot : record -> slots) {
+		slot.store(nullptr, std::memory_order_release);
+	}
+	_scan(retired);
+	if(!retired.empty()) {
+		std::lock_guard<std::mutex> guard(orphan_lock);
+		orphans.insert(orphans.end(), retired.begin(), retired.end());
+	}
+	record -> active.store(false, std::memory_order_release);
+}
+
+inline hazard_pointers::Local& hazard_pointers::_local() {
+	thread_local Local local;
+	return local;
+}
+
+inline void hazard_pointers::_scan(std::vector<Retired>& retired) {
+	//take over what exited threads left, unless another scan does already
+	std::unique_lock<std::mutex> guard(orphan_lock, std::try_to_lock);
+	if(guard.owns_lock() && !orphans.empty()) {
+		retired.insert(retired.end(), orphans.begin(), orphans.end());
+		orphans.clear();
+	}
+	if(guard.owns_lock()) {
+		guard.unlock();
+	}
+	//seq_cst loads pair with the seq_cst unlinking and publishing of nodes
+	std::vector<void*> held;
+	for(Record* record = records.load(std::memory_order_acquire); record; record = record -> next) {
+		for(std::atomic<void*>& slot : record -> slots) {
+			void* node = slot.load(std::memory_order_seq_cst);
+			if(node != nullptr) {
+				held.push_back(node);
+			}
+		}
+	}
+	std::size_t kept = 0;
+	for(std::size_t i = 0; i < retired.size(); i++) {
+		bool hazard = false;
+		for(void* node : held) {
+			hazard |= node == retired[i].node;
+		}
+		if(hazard) {
+			retired[kept++] = retired[i];
+		}
+		else {
+			retired[i].deleter(retired[i].node);
+		}
+	}
+	retired.resize(kept);
+}
+
+#endif
@@ -0,0 +1,372 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef INTERLEAVE_VIEW_HPP
+#define INTERLEAVE_VIEW_HPP
+
+//dependencies
+#include <array>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "bi_ring.hpp"
+
+/*
+	Lazy interleaving of K rings, the pattern shuffle() builds.
+	Each repetition takes the next count[k] elements of every ring in
+	turn, walking each ring circularly from its start. The view owns
+	nothing and reads through to the rings, so they must outlive it
+	and stay unchanged while it is iterated. Over non-const rings the
+	sequence can also be materialized by moving, which consumes every
+	element the pattern reads instead of copying it.
+*/
+template <typename Ring, unsigned int K>
+class interleave_view {
+	static_assert(K > 0, "Interleaving needs at least one ring.");
+	using ring_type = std::remove_const_t<Ring>;
+	using cursor = typename ring_type::const_iterator;
+
+public:
+	//(de)constructors
+	interleave_view(const std::array<Ring*, K>& rings,
+			const std::array<unsigned int, K>& counts,
+			unsigned int reps); //DONE
+
+	//iterators
+	class const_iterator; //DONE
+
+	//getter methods
+	unsigned int size() const; //DONE
+	const_iterator begin() const; //DONE
+	const_iterator end() const; //DONE
+
+	//materializing methods
+	ring_type materialize() const; //DONE
+	//moves the payload on the last read of each element, earlier reads copy
+	ring_type materialize_move(); //DONE
+
+private:
+	//storage members
+	std::array<Ring*, K> rings;
+	std::array<unsigned int, K> counts;
+	unsigned int reps;
+};
+
+template <typename Ring, unsigned int K>
+class interleave_view<Ring, K>::const_iterator {
+
+friend interleave_view<Ring, K>;
+
+public:
+	using iterator_category = std::bidirectional_iterator_tag;
+	using reference = decltype(*std::declval<const cursor&>());
+	using value_type = std::remove_cv_t<std::remove_reference_t<reference>>;
+	using pointer = const value_type*;
+	using difference_type = std::ptrdiff_t;
+
+	const_iterator(); //DONE
+
+	const_iterator& operator++(); //DONE
+	const_iterator operator++(int); //DONE
+	const_iterator& operator--(); //DONE
+	const_iterator operator--(int); //DONE
+	reference operator*() const; //DONE
+	bool operator==(const const_iterator& itr) const; //DONE
+	bool operator!=(const const_iterator& itr) const; //DONE
+
+	//custom getters
+	decltype(std::declval<const cursor&>().key()) key() const; //DONE
+	reference info() const; //DONE
+private:
+	const interleave_view<Ring, K>* view;
+	//per ring, the next element it gives
+	std::array<cursor, K> cursors;
+	unsigned int rep;
+	unsigned int input;
+	unsigned int step;
+};
+
+//view of shuffle(first, fcnt, secnd, scnt, reps)
+template <typename Ring>
+interleave_view<Ring, 2> interleave(Ring& first, unsigned int fcnt,
+				    Ring& secnd, unsigned int scnt,
+				    unsigned int reps); //DONE
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Ring, unsigned int K>
+interleave_view<Ring, K>::interleave_view(const std::array<Ring*, K>& rings,
+					  const std::array<unsigned int, K>& counts,
+					  unsigned int reps)
+	: rings(rings), counts(counts), reps(reps) {
+	//same requirements as shuffle
+	for(unsigned int k = 0; k < K; k++) {
+		if(!rings[k] || rings[k] -> empty()) {
+			throw std::invalid_argument("One of the rings is empty.");
+		}
+		if(!counts[k]) {
+			throw std::invalid_argument("These count parameters result in no shuffling.");
+		}
+	}
+	if(!reps) {
+		throw std::invalid_argument("These count parameters result in no shuffling.");
+	}
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Ring, unsigned int K>
+unsigned int interleave_view<Ring, K>::size() const {
+	unsigned int total = 0;
+	for(unsigned int count : counts) {
+		total += count;
+	}
+	return total * reps;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator
+interleave_view<Ring, K>::begin() const {
+	const_iterator itr;
+	itr.view = this;
+	for(unsigned int k = 0; k < K; k++) {
+		itr.cursors[k] = cursor(*rings[k]);
+	}
+	return itr;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator
+interleave_view<Ring, K>::end() const {
+	const_iterator itr = begin();
+	itr.rep = reps;
+	//every ring stops where the last repetition left it, so end can be stepped back
+	for(unsigned int k = 0; k < K; k++) {
+		unsigned long long steps = static_cast<unsigned long long>(reps) * counts[k] % rings[k] -> size();
+		for(; steps; steps--) {
+			++itr.cursors[k];
+		}
+	}
+	return itr;
+}
+
+/*
+	MATERIALIZING METHODS
+*/
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::ring_type
+interleave_view<Ring, K>::materialize() const {
+	ring_type result;
+	const_iterator itr = begin();
+	for(unsigned int left = size(); left; left--, ++itr) {
+		result.push(itr.key(), itr.info());
+	}
+	return result;
+}
+
+//moves elements out of the rings onto the end of dest, one payload at a time
+template <typename Ring>
+class _interleave_mover {
+public:
+	explicit _interleave_mover(Ring& dest) : dest(dest) {
+	}
+	//called before the first move out of src, count elements from cursor on will follow
+	void stage(Ring&, typename Ring::iterator&, unsigned long long) {
+	}
+	//moves count elements from cursor on, cursor ends on the one after
+	void move(Ring& src, typename Ring::iterator& cursor, unsigned int count) {
+		for(; count; count--) {
+			dest.push(std::move(cursor.key()), std::move(cursor.info()));
+			cursor = src.remove(cursor);
+		}
+	}
+private:
+	Ring& dest;
+};
+
+//linked rings relink their nodes instead, gathering them in one staging ring
+//first, so every later splice into dest comes from a single pool
+template <typename Key, typename Info, typename Alloc>
+class _interleave_mover<bi_ring<Key, Info, Alloc>> {
+	using ring = bi_ring<Key, Info, Alloc>;
+public:
+	explicit _interleave_mover(ring& dest) : dest(dest), staged(dest.get_allocator()) {
+	}
+	void stage(ring& src, typename ring::iterator& cursor, unsigned long long count) {
+		//nodes keep their order starting from cursor, which stays on the first one
+		staged.splice(staged.begin(), src, cursor, _skip(cursor, count));
+	}
+	void move(ring&, typename ring::iterator& cursor, unsigned int count) {
+		if(count == staged.size()) {
+			dest.splice(dest.begin(), std::move(staged));
+			return;
+		}
+		typename ring::iterator last = _skip(cursor, count);
+		dest.splice(dest.begin(), staged, cursor, last);
+		cursor = last;
+	}
+private:
+	ring& dest;
+	ring staged;
+	static typename ring::iterator _skip(typename ring::iterator from, unsigned long long count) {
+		for(; count; count--) {
+			++from;
+		}
+		return from;
+	}
+};
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::ring_type
+interleave_view<Ring, K>::materialize_move() {
+	static_assert(!std::is_const<Ring>::value, "Moving out needs non-const rings.");
+	for(unsigned int k = 0; k < K; k++) {
+		for(unsigned int j = 0; j < k; j++) {
+			if(rings[j] == rings[k]) {
+				throw std::invalid_argument("A ring cannot be consumed twice.");
+			}
+		}
+	}
+	ring_type result;
+	_interleave_mover<ring_type> mover(result);
+	std::array<typename ring_type::iterator, K> cursors;
+	std::array<unsigned long long, K> total;
+	std::array<unsigned long long, K> reads;
+	std::array<unsigned long long, K> copies;
+	for(unsigned int k = 0; k < K; k++) {
+		cursors[k] = rings[k] -> begin();
+		total[k] = static_cast<unsigned long long>(reps) * counts[k];
+		reads[k] = 0;
+		//reads before the final pass over a ring are repeated later, so they copy
+		copies[k] = total[k] > rings[k] -> size() ? total[k] - rings[k] -> size() : 0;
+	}
+	for(unsigned int i = 0; i < reps; i++) {
+		for(unsigned int k = 0; k < K; k++) {
+			unsigned int copied = 0;
+			if(reads[k] < copies[k]) {
+				copied = static_cast<unsigned int>(std::min<unsigned long long>(counts[k],
+												copies[k] - reads[k]));
+			}
+			for(unsigned int j = 0; j < copied; j++) {
+				result.push(cursors[k].key(), cursors[k].info());
+				++cursors[k];
+			}
+			if(copied < counts[k]) {
+				if(reads[k] + copied == copies[k]) {
+					mover.stage(*rings[k], cursors[k], total[k] - copies[k]);
+				}
+				mover.move(*rings[k], cursors[k], counts[k] - copied);
+			}
+			reads[k] += counts[k];
+		}
+	}
+	return result;
+}
+
+/*
+	ITERATOR
+*/
+
+template <typename Ring, unsigned int K>
+interleave_view<Ring, K>::const_iterator::const_iterator()
+	: view(nullptr), rep(0), input(0), step(0) {
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator&
+interleave_view<Ring, K>::const_iterator::operator++() {
+	++cursors[input];
+	//finished this ring's share, pass on to the next one
+	if(++step == view -> counts[input]) {
+		step = 0;
+		if(++input == K) {
+			input = 0;
+			rep++;
+		}
+	}
+	return *this;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator
+interleave_view<Ring, K>::const_iterator::operator++(int) {
+	const_iterator old(*this);
+	++(*this);
+	return old;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator&
+interleave_view<Ring, K>::const_iterator::operator--() {
+	//at the start of a share, go back to the end of the previous one
+	if(!step) {
+		if(!input) {
+			input = K;
+			rep--;
+		}
+		input--;
+		step = view -> counts[input];
+	}
+	step--;
+	--cursors[input];
+	return *this;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator
+interleave_view<Ring, K>::const_iterator::operator--(int) {
+	const_iterator old(*this);
+	--(*this);
+	return old;
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator::reference
+interleave_view<Ring, K>::const_iterator::operator*() const {
+	return *cursors[input];
+}
+
+template <typename Ring, unsigned int K>
+bool interleave_view<Ring, K>::const_iterator::operator==(const const_iterator& itr) const {
+	return view == itr.view && rep == itr.rep && input == itr.input && step == itr.step;
+}
+
+template <typename Ring, unsigned int K>
+bool interleave_view<Ring, K>::const_iterator::operator!=(const const_iterator& itr) const {
+	return !(*this == itr);
+}
+
+template <typename Ring, unsigned int K>
+decltype(std::declval<const typename interleave_view<Ring, K>::cursor&>().key())
+interleave_view<Ring, K>::const_iterator::key() const {
+	return cursors[input].key();
+}
+
+template <typename Ring, unsigned int K>
+typename interleave_view<Ring, K>::const_iterator::reference
+interleave_view<Ring, K>::const_iterator::info() const {
+	return cursors[input].info();
+}
+
+/*
+	FACTORY
+*/
+
+template <typename Ring>
+interleave_view<Ring, 2> interleave(Ring& first, unsigned int fcnt,
+				    Ring& secnd, unsigned int scnt,
+				    unsigned int reps) {
+	return interleave_view<Ring, 2>({&first, &secnd}, {fcnt, scnt}, reps);
+}
+
+#endif
@@ -0,0 +1,206 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef KEY_SCAN_HPP
+#define KEY_SCAN_HPP
+
+//dependencies
+#include <climits>
+#include <type_traits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define KEY_SCAN_X86 1
+#include <immintrin.h>
+#endif
+
+/*
+	Search over a contiguous array of keys.
+	Integral keys of 4 or 8 bytes, float and double keys are compared
+	several at a time with AVX2 or SSE4, picked once at runtime from
+	what the processor supports. Other key types, and the leftover
+	tail of every array, go through the plain loop.
+*/
+enum class scan_isa { scalar, sse4, avx2 };
+
+//instruction set used by the scan, may be lowered to force a narrower path
+inline scan_isa& key_scan_isa() {
+	static scan_isa isa = [] {
+#ifdef KEY_SCAN_X86
+		__builtin_cpu_init();
+		if(__builtin_cpu_supports("avx2")) {
+			return scan_isa::avx2;
+		}
+		if(__builtin_cpu_supports("sse4.1")) {
+			return scan_isa::sse4;
+		}
+#endif
+		return scan_isa::scalar;
+	}();
+	return isa;
+}
+
+//finds the nth match in keys, gives back its index or n after lowering nth by the matches seen
+template <typename Key>
+unsigned int key_locate(const Key* keys, unsigned int n,
+			const Key& key, unsigned int& nth); //DONE
+//counts matches in keys
+template <typename Key>
+unsigned int key_count(const Key* keys, unsigned int n, const Key& key); //DONE
+
+/*
+	HELPERS
+*/
+
+enum class scan_lane { none, i32, i64, f32, f64 };
+
+template <typename Key>
+constexpr scan_lane _lane_of() {
+	if constexpr(std::is_integral<Key>::value && sizeof(Key) == 4) {
+		return scan_lane::i32;
+	}
+	else if constexpr(std::is_integral<Key>::value && sizeof(Key) == 8) {
+		return scan_lane::i64;
+	}
+	else if constexpr(std::is_same<Key, float>::value) {
+		return scan_lane::f32;
+	}
+	else if constexpr(std::is_same<Key, double>::value) {
+		return scan_lane::f64;
+	}
+	return scan_lane::none;
+}
+
+template <typename Key>
+unsigned int _locate_scalar(const Key* keys, unsigned int from, unsigned int n,
+			    const Key& key, unsigned int& nth) {
+	for(unsigned int i = from; i < n; i++) {
+		if(keys[i] == key && nth-- == 1) {
+			return i;
+		}
+	}
+	return n;
+}
+
+#ifdef KEY_SCAN_X86
+
+//one bit per compared key, picks the nth set bit if the block holds it
+inline bool _take_match(unsigned int mask, unsigned int base,
+			unsigned int& nth, unsigned int& found) {
+	unsigned int hits = __builtin_popcount(mask);
+	if(hits < nth) {
+		nth -= hits;
+		return false;
+	}
+	//drop the matches before the wanted one
+	for(unsigned int skip = nth - 1; skip; skip--) {
+		mask &= mask - 1;
+	}
+	nth = 1;
+	found = base + __builtin_ctz(mask);
+	return true;
+}
+
+template <typename Key>
+__attribute__((target("avx2")))
+unsigned int _locate_avx2(const Key* keys, unsigned int n,
+			  const Key& key, unsigned int& nth) {
+	constexpr scan_lane lane = _lane_of<Key>();
+	constexpr unsigned int width = 32 / sizeof(Key);
+	unsigned int i = 0;
+	unsigned int found;
+	for(; i + width <= n; i += width) {
+		unsigned int mask;
+		if constexpr(lane == scan_lane::i32) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+			__m256i equal = _mm256_cmpeq_epi32(block, _mm256_set1_epi32(static_cast<int>(key)));
+			mask = _mm256_movemask_ps(_mm256_castsi256_ps(equal));
+		}
+		else if constexpr(lane == scan_lane::i64) {
+			__m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+			__m256i equal = _mm256_cmpeq_epi64(block, _mm256_set1_epi64x(static_cast<long long>(key)));
+			mask = _mm256_movemask_pd(_mm256_castsi256_pd(equal));
+		}
+		else if constexpr(lane == scan_lane::f32) {
+			mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(keys + i),
+								_mm256_set1_ps(key), _CMP_EQ_OQ));
+		}
+		else {
+			mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(keys + i),
+								_mm256_set1_pd(key), _CMP_EQ_OQ));
+		}
+		if(mask && _take_match(mask, i, nth, found)) {
+			return found;
+		}
+	}
+	return _locate_scalar(keys, i, n, key, nth);
+}
+
+template <typename Key>
+__attribute__((target("sse4.1")))
+unsigned int _locate_sse4(const Key* keys, unsigned int n,
+			  const Key& key, unsigned int& nth) {
+	constexpr scan_lane lane = _lane_of<Key>();
+	constexpr unsigned int width = 16 / sizeof(Key);
+	unsigned int i = 0;
+	unsigned int found;
+	for(; i + width <= n; i += width) {
+		unsigned int mask;
+		if constexpr(lane == scan_lane::i32) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+			__m128i equal = _mm_cmpeq_epi32(block, _mm_set1_epi32(static_cast<int>(key)));
+			mask = _mm_movemask_ps(_mm_castsi128_ps(equal));
+		}
+		else if constexpr(lane == scan_lane::i64) {
+			__m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+			__m128i equal = _mm_cmpeq_epi64(block, _mm_set1_epi64x(static_cast<long long>(key)));
+			mask = _mm_movemask_pd(_mm_castsi128_pd(equal));
+		}
+		else if constexpr(lane == scan_lane::f32) {
+			mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(keys + i), _mm_set1_ps(key)));
+		}
+		else {
+			mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(keys + i), _mm_set1_pd(key)));
+		}
+		if(mask && _take_match(mask, i, nth, found)) {
+			return found;
+		}
+	}
+	return _locate_scalar(keys, i, n, key, nth);
+}
+
+#endif
+
+/*
+	SCAN FUNCTIONS
+*/
+
+template <typename Key>
+unsigned int key_locate(const Key* keys, unsigned int n,
+			const Key& key, unsigned int& nth) {
+#ifdef KEY_SCAN_X86
+	if constexpr(_lane_of<Key>() != scan_lane::none) {
+		switch(key_scan_isa()) {
+		case scan_isa::avx2:
+			return _locate_avx2(keys, n, key, nth);
+		case scan_isa::sse4:
+			return _locate_sse4(keys, n, key, nth);
+		case scan_isa::scalar:
+			break;
+		}
+	}
+#endif
+	return _locate_scalar(keys, 0, n, key, nth);
+}
+
+template <typename Key>
+unsigned int key_count(const Key* keys, unsigned int n, const Key& key) {
+	//an unreachable occurrence number makes locate count every match
+	unsigned int nth = UINT_MAX;
+	key_locate(keys, n, key, nth);
+	return UINT_MAX - nth;
+}
+
+#endif
@@ -0,0 +1,362 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef NODE_POOL_HPP
+#define NODE_POOL_HPP
+
+//dependencies
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <utility>
+
+/*
+	Slab allocator handing out storage for single nodes.
+	Storage comes in cache-line aligned blocks obtained from Alloc,
+	released slots are kept on a free list and handed out first.
+	Pools may adopt the blocks of another pool with an equal allocator,
+	all of them or only the ones holding given nodes, after which those
+	nodes can be moved between their owners freely. Each block is
+	released once the last pool holding it lets go. The first blocks
+	held are listed inline, so holding a few takes no allocation.
+*/
+template <typename Node, typename Alloc = std::allocator<Node>>
+class node_pool {
+	static constexpr std::size_t line_size = 64;
+	struct alignas(line_size) Line {
+		unsigned char bytes[line_size];
+	};
+	using line_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<Line>;
+	using line_traits = std::allocator_traits<line_alloc>;
+public:
+	//(de)constructors
+	explicit node_pool(const Alloc& alloc = Alloc());
+	node_pool(const node_pool& src) = delete;
+	node_pool(node_pool&& src);
+	~node_pool();
+
+	//operators
+	node_pool& operator=(const node_pool& src) = delete;
+	node_pool& operator=(node_pool&& src);
+
+	//slot management
+	void* allocate();
+	void deallocate(void* slot);
+	void reserve(unsigned int count);
+	void swap(node_pool& other);
+	void reset(const Alloc& alloc);
+	void adopt(const node_pool& other);
+	void adopt(const node_pool& other, const void* slot);
+
+	//getter methods
+	Alloc get_allocator() const;
+
+private:
+	static constexpr unsigned int first_block = 32;
+	static constexpr unsigned int max_block = 4096;
+	//storage members
+	union Slot {
+		Slot* next;
+		alignas(Node) unsigned char storage[sizeof(Node)];
+	};
+	struct alignas(line_size) Block {
+		std::atomic<unsigned int> owners;
+		std::size_t lines;
+		Slot* slots();
+	};
+	static constexpr unsigned int per_line = line_size / sizeof(Block*);
+	line_alloc source;
+	//held blocks, sorted by address, in local until it runs out of room
+	Block** blocks;
+	unsigned int held;
+	unsigned int room;
+	Block* local[per_line];
+	//block last adopted for a single slot, tried first for the next one
+	Block* recent;
+	Slot* free_list;
+	Slot* bump;
+	Slot* bump_end;
+	unsigned int grow;
+	//identifies the held block set, 0 while nothing is held
+	unsigned long long stamp;
+	//stamp of a block set known to be held already
+	unsigned long long adopted;
+	//helper methods
+	static unsigned long long _next_stamp();
+	void _add_block(unsigned int capacity);
+	void _hold(Block* block);
+	static bool _contains(const Block* block, const void* slot);
+	void _release();
+	void _swap_storage(node_pool& other);
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Node, typename Alloc>
+node_pool<Node, Alloc>::node_pool(const Alloc& alloc) : source(alloc) {
+	blocks = local;
+	held = 0;
+	room = per_line;
+	recent = nullptr;
+	free_list = nullptr;
+	bump = nullptr;
+	bump_end = nullptr;
+	grow = first_block;
+	stamp = 0;
+	adopted = 0;
+}
+
+template <typename Node, typename Alloc>
+node_pool<Node, Alloc>::node_pool(node_pool&& src) : node_pool(Alloc(src.source)) {
+	//allocator was moved along, storage can be taken over as is
+	_swap_storage(src);
+}
+
+template <typename Node, typename Alloc>
+node_pool<Node, Alloc>::~node_pool() {
+	_release();
+}
+
+/*
+	OPERATORS
+*/
+
+template <typename Node, typename Alloc>
+node_pool<Node, Alloc>& node_pool<Node, Alloc>::operator=(node_pool&& src) {
+	//non-propagating allocators are required to compare equal by the owner
+	if(this != &src) {
+		_release();
+		if constexpr(line_traits::propagate_on_container_move_assignment::value) {
+			source = std::move(src.source);
+		}
+		_swap_storage(src);
+	}
+	return *this;
+}
+
+/*
+	SLOT MANAGEMENT
+*/
+
+template <typename Node, typename Alloc>
+void* node_pool<Node, Alloc>::allocate() {
+	//reuse released slots first
+	if(free_list != nullptr) {
+		Slot* slot = free_list;
+		free_list = slot -> next;
+		return slot;
+	}
+	//carve a new slot out of the current block
+	if(bump == bump_end) {
+		_add_block(grow);
+		if(grow < max_block) {
+			grow *= 2;
+		}
+	}
+	return bump++;
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::deallocate(void* slot) {
+	Slot* released = static_cast<Slot*>(slot);
+	released -> next = free_list;
+	free_list = released;
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::reserve(unsigned int count) {
+	//count slots that can be handed out without allocating
+	unsigned int available = bump_end - bump;
+	for(Slot* slot = free_list; slot != nullptr && available < count; slot = slot -> next) {
+		available++;
+	}
+	if(available >= count) {
+		return;
+	}
+	//move leftovers of the current block to the free list
+	while(bump != bump_end) {
+		deallocate(bump++);
+	}
+	_add_block(count - available);
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::swap(node_pool& other) {
+	//non-propagating allocators are required to compare equal by the owner
+	if constexpr(line_traits::propagate_on_container_swap::value) {
+		using std::swap;
+		swap(source, other.source);
+	}
+	_swap_storage(other);
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::reset(const Alloc& alloc) {
+	//drop all storage and start over with a new allocator
+	_release();
+	if constexpr(line_traits::propagate_on_container_copy_assignment::value) {
+		source = line_alloc(alloc);
+	}
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::adopt(const node_pool& other) {
+	//allocators are required to compare equal by the owner
+	//repeated splices from one ring find its blocks held since last time
+	if(other.stamp == adopted) {
+		return;
+	}
+	for(unsigned int i = 0; i < other.held; i++) {
+		Block* block = other.blocks[i];
+		if(!std::binary_search(blocks, blocks + held, block, std::less<Block*>())) {
+			block -> owners++;
+			_hold(block);
+		}
+	}
+	adopted = other.stamp;
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::adopt(const node_pool& other, const void* slot) {
+	//allocators are required to compare equal by the owner
+	//runs of nodes mostly share a block, only look up the next one they reach
+	if(other.stamp == adopted || (recent != nullptr && _contains(recent, slot))) {
+		return;
+	}
+	//the last block starting at or before slot holds it
+	Block** after = std::upper_bound(other.blocks, other.blocks + other.held, slot,
+					 [](const void* at, const Block* block) {
+						 return std::less<const void*>()(at, block);
+					 });
+	Block* block = *(after - 1);
+	if(!std::binary_search(blocks, blocks + held, block, std::less<Block*>())) {
+		block -> owners++;
+		_hold(block);
+	}
+	recent = block;
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Node, typename Alloc>
+Alloc node_pool<Node, Alloc>::get_allocator() const {
+	return Alloc(source);
+}
+
+/*
+	HELPERS
+*/
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::_swap_storage(node_pool& other) {
+	//inline tables trade contents, each pool keeps pointing at its own
+	bool mine = blocks == local;
+	bool theirs = other.blocks == other.local;
+	std::swap_ranges(local, local + per_line, other.local);
+	std::swap(blocks, other.blocks);
+	if(theirs) {
+		blocks = local;
+	}
+	if(mine) {
+		other.blocks = other.local;
+	}
+	std::swap(held, other.held);
+	std::swap(room, other.room);
+	std::swap(recent, other.recent);
+	std::swap(free_list, other.free_list);
+	std::swap(bump, other.bump);
+	std::swap(bump_end, other.bump_end);
+	std::swap(grow, other.grow);
+	std::swap(stamp, other.stamp);
+	std::swap(adopted, other.adopted);
+}
+
+template <typename Node, typename Alloc>
+typename node_pool<Node, Alloc>::Slot* node_pool<Node, Alloc>::Block::slots() {
+	return reinterpret_cast<Slot*>(this + 1);
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::_add_block(unsigned int capacity) {
+	//block header is followed directly by its slots
+	std::size_t count = (sizeof(Block) + capacity * sizeof(Slot) + line_size - 1) / line_size;
+	Line* raw = line_traits::allocate(source, count);
+	Block* block = ::new (static_cast<void*>(raw)) Block;
+	block -> owners = 1;
+	block -> lines = count;
+	_hold(block);
+	bump = block -> slots();
+	bump_end = bump + capacity;
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::_hold(Block* block) {
+	//block table lives in whole lines, grow it by doubling
+	if(held == room) {
+		unsigned int grown = room * 2;
+		Line* raw = line_traits::allocate(source, grown / per_line);
+		Block** table = reinterpret_cast<Block**>(raw);
+		std::copy(blocks, blocks + held, table);
+		if(blocks != local) {
+			line_traits::deallocate(source, reinterpret_cast<Line*>(blocks), room / per_line);
+		}
+		blocks = table;
+		room = grown;
+	}
+	Block** at = std::lower_bound(blocks, blocks + held, block, std::less<Block*>());
+	std::copy_backward(at, blocks + held, blocks + held + 1);
+	*at = block;
+	held++;
+	stamp = _next_stamp();
+}
+
+template <typename Node, typename Alloc>
+bool node_pool<Node, Alloc>::_contains(const Block* block, const void* slot) {
+	const Line* first = reinterpret_cast<const Line*>(block);
+	return !std::less<const void*>()(slot, first) && std::less<const void*>()(slot, first + block -> lines);
+}
+
+template <typename Node, typename Alloc>
+void node_pool<Node, Alloc>::_release() {
+	//nodes must have been destroyed by their owners already
+	for(unsigned int i = 0; i < held; i++) {
+		Block* block = blocks[i];
+		if(--(block -> owners) == 0) {
+			std::size_t lines = block -> lines;
+			block -> ~Block();
+			line_traits::deallocate(source, reinterpret_cast<Line*>(block), lines);
+		}
+	}
+	if(blocks != local) {
+		line_traits::deallocate(source, reinterpret_cast<Line*>(blocks), room / per_line);
+	}
+	blocks = local;
+	held = 0;
+	room = per_line;
+	recent = nullptr;
+	free_list = nullptr;
+	bump = nullptr;
+	bump_end = nullptr;
+	grow = first_block;
+	stamp = 0;
+	adopted = 0;
+}
+
+template <typename Node, typename Alloc>
+unsigned long long node_pool<Node, Alloc>::_next_stamp() {
+	//shared by all pools of this type, so equal stamps mean the same block set
+	static std::atomic<unsigned long long> counter(0);
+	return ++counter;
+}
+
+#endif
@@ -0,0 +1,267 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef POSITION_INDEX_HPP
+#define POSITION_INDEX_HPP
+
+//dependencies
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include "node_pool.hpp"
+
+/*
+	Order statistic index over the elements of a sequence.
+	Handles are kept in an implicit treap ordered by position, each
+	tree node counting the size of its subtree, and a hash map leads
+	from a handle to its tree node. Lookups by position, positions of
+	handles, insertions and removals all take O(log n) expected time.
+*/
+template <typename Handle>
+class position_index {
+public:
+	//(de)constructors
+	position_index();
+	position_index(const position_index& src) = delete;
+
+	//operators
+	position_index& operator=(const position_index& src) = delete;
+
+	//index management
+	void insert(unsigned int pos, Handle item);
+	void erase(Handle item);
+	//first and secnd trade positions
+	void exchange(Handle first, Handle secnd);
+	void clear();
+	//element at pos becomes the first one, order kept otherwise
+	void rotate(unsigned int pos);
+
+	//getter methods
+	unsigned int size() const;
+	bool contains(Handle item) const;
+	unsigned int position_of(Handle item) const;
+	Handle at(unsigned int pos) const;
+
+private:
+	//storage members
+	struct Node {
+		Node* left;
+		Node* right;
+		Node* parent;
+		unsigned int priority;
+		unsigned int count;
+		Handle item;
+	};
+	Node* root;
+	std::unordered_map<Handle, Node*> nodes;
+	node_pool<Node> pool;
+	unsigned int seed;
+	//helper methods
+	static unsigned int _count(const Node* node);
+	static void _update(Node* node);
+	static void _split(Node* tree, unsigned int pos, Node*& left, Node*& right);
+	static Node* _merge(Node* left, Node* right);
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Handle>
+position_index<Handle>::position_index() : root(nullptr), seed(2463534242u) {
+}
+
+/*
+	INDEX MANAGEMENT
+*/
+
+template <typename Handle>
+void position_index<Handle>::insert(unsigned int pos, Handle item) {
+	if(pos > size()) {
+		throw std::out_of_range("Position exceeds index size.");
+	}
+	//draw a priority from a xorshift sequence
+	seed ^= seed << 13;
+	seed ^= seed >> 17;
+	seed ^= seed << 5;
+	Node* node = new(pool.allocate()) Node{nullptr, nullptr, nullptr, seed, 1, item};
+	nodes[item] = node;
+	//cut the tree at pos and put the node in between
+	Node* left;
+	Node* right;
+	_split(root, pos, left, right);
+	root = _merge(_merge(left, node), right);
+	root -> parent = nullptr;
+}
+
+template <typename Handle>
+void position_index<Handle>::erase(Handle item) {
+	auto found = nodes.find(item);
+	if(found == nodes.end()) {
+		return;
+	}
+	Node* node = found -> second;
+	nodes.erase(found);
+	//join both subtrees in place of the node
+	Node* parent = node -> parent;
+	Node* joined = _merge(node -> left, node -> right);
+	if(joined) {
+		joined -> parent = parent;
+	}
+	if(!parent) {
+		root = joined;
+	}
+	else if(parent -> left == node) {
+		parent -> left = joined;
+	}
+	else {
+		parent -> right = joined;
+	}
+	for(; parent; parent = parent -> parent) {
+		parent -> count--;
+	}
+	pool.deallocate(node);
+}
+
+template <typename Handle>
+void position_index<Handle>::exchange(Handle first, Handle secnd) {
+	Node*& one = nodes.at(first);
+	Node*& other = nodes.at(secnd);
+	std::swap(one -> item, other -> item);
+	std::swap(one, other);
+}
+
+template <typename Handle>
+void position_index<Handle>::clear() {
+	root = nullptr;
+	nodes.clear();
+	pool.reset(pool.get_allocator());
+}
+
+template <typename Handle>
+void position_index<Handle>::rotate(unsigned int pos) {
+	if(pos > size()) {
+		throw std::out_of_range("Position exceeds index size.");
+	}
+	//the part in front of pos goes behind the rest
+	Node* left;
+	Node* right;
+	_split(root, pos, left, right);
+	root = _merge(right, left);
+	if(root) {
+		root -> parent = nullptr;
+	}
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Handle>
+unsigned int position_index<Handle>::size() const {
+	return _count(root);
+}
+
+template <typename Handle>
+bool position_index<Handle>::contains(Handle item) const {
+	return nodes.count(item) != 0;
+}
+
+template <typename Handle>
+unsigned int position_index<Handle>::position_of(Handle item) const {
+	auto found = nodes.find(item);
+	if(found == nodes.end()) {
+		throw std::invalid_argument("Element is not indexed.");
+	}
+	//everything left of the path up to the root comes first
+	const Node* node = found -> second;
+	unsigned int pos = _count(node -> left);
+	for(; node -> parent; node = node -> parent) {
+		if(node -> parent -> right == node) {
+			pos += _count(node -> parent -> left) + 1;
+		}
+	}
+	return pos;
+}
+
+template <typename Handle>
+Handle position_index<Handle>::at(unsigned int pos) const {
+	if(pos >= size()) {
+		throw std::out_of_range("Position exceeds index size.");
+	}
+	const Node* node = root;
+	while(true) {
+		unsigned int before = _count(node -> left);
+		if(pos < before) {
+			node = node -> left;
+		}
+		else if(pos == before) {
+			return node -> item;
+		}
+		else {
+			pos -= before + 1;
+			node = node -> right;
+		}
+	}
+}
+
+/*
+	HELPERS
+*/
+
+template <typename Handle>
+unsigned int position_index<Handle>::_count(const Node* node) {
+	return node ? node -> count : 0;
+}
+
+template <typename Handle>
+void position_index<Handle>::_update(Node* node) {
+	node -> count = _count(node -> left) + _count(node -> right) + 1;
+	if(node -> left) {
+		node -> left -> parent = node;
+	}
+	if(node -> right) {
+		node -> right -> parent = node;
+	}
+}
+
+template <typename Handle>
+void position_index<Handle>::_split(Node* tree, unsigned int pos, Node*& left, Node*& right) {
+	if(!tree) {
+		left = right = nullptr;
+		return;
+	}
+	//first pos elements go to the left part
+	if(_count(tree -> left) < pos) {
+		_split(tree -> right, pos - _count(tree -> left) - 1, tree -> right, right);
+		left = tree;
+	}
+	else {
+		_split(tree -> left, pos, left, tree -> left);
+		right = tree;
+	}
+	_update(tree);
+	tree -> parent = nullptr;
+}
+
+template <typename Handle>
+typename position_index<Handle>::Node*
+position_index<Handle>::_merge(Node* left, Node* right) {
+	if(!left || !right) {
+		return left ? left : right;
+	}
+	//higher priority stays on top
+	if(left -> priority > right -> priority) {
+		left -> right = _merge(left -> right, right);
+		_update(left);
+		return left;
+	}
+	right -> left = _merge(left, right -> left);
+	_update(right);
+	return right;
+}
+
+#endif
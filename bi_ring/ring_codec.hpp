@@ -0,0 +1,100 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef RING_CODEC_HPP
+#define RING_CODEC_HPP
+
+//dependencies
+#include <algorithm>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+/*
+	Binary encoding of keys and infos for saved rings.
+	ring_codec<T> is the customization point, a specialization gives a
+	tag and a size telling its encoding apart in the file header, and
+	write() and read() for single values. Arithmetic types come encoded
+	as their raw bytes, which lets whole runs of elements be copied as one
+	block, strings as their length followed by their characters. Every
+	other type needs a specialization of its own with a tag of 256 or
+	above, unique to the type, since the tag is all that tells two types
+	of one size apart. Trivially copyable types can derive it from
+	raw_codec<T, tag> and keep the block copies, others set raw to false.
+*/
+template <typename T, typename = void>
+struct ring_codec;
+
+//raw bytes in native byte order
+template <typename T, std::uint32_t Tag>
+struct raw_codec {
+	static_assert(std::is_trivially_copyable<T>::value && std::is_default_constructible<T>::value,
+		      "Raw encoding needs a trivially copyable, default constructible type.");
+	static constexpr bool raw = true;
+	static constexpr std::uint32_t tag = Tag;
+	static constexpr std::uint32_t size = sizeof(T);
+	static void write(std::ostream& str, const T& value) {
+		str.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+	static T read(std::istream& str) {
+		T value;
+		str.read(reinterpret_cast<char*>(&value), sizeof(T));
+		return value;
+	}
+};
+
+//numbers tell signed, unsigned and floating point apart, size does the rest
+template <typename T>
+struct ring_codec<T, std::enable_if_t<std::is_arithmetic<T>::value>>
+	: raw_codec<T, std::is_floating_point<T>::value ? 3 :
+		       std::is_signed<T>::value ? 1 : 2> {};
+
+//length in characters, then the characters
+template <typename Char, typename Traits, typename Alloc>
+struct ring_codec<std::basic_string<Char, Traits, Alloc>> {
+	static constexpr bool raw = false;
+	static constexpr std::uint32_t tag = 16;
+	static constexpr std::uint32_t size = sizeof(Char);
+	static void write(std::ostream& str, const std::basic_string<Char, Traits, Alloc>& value) {
+		std::uint64_t length = value.size();
+		str.write(reinterpret_cast<const char*>(&length), sizeof(length));
+		str.write(reinterpret_cast<const char*>(value.data()), value.size() * sizeof(Char));
+	}
+	static std::basic_string<Char, Traits, Alloc> read(std::istream& str) {
+		std::uint64_t length = 0;
+		str.read(reinterpret_cast<char*>(&length), sizeof(length));
+		std::basic_string<Char, Traits, Alloc> value;
+		//grown as characters arrive, a corrupt length cannot claim memory up front
+		const std::uint64_t chunk = 4096;
+		for(std::uint64_t done = 0; str && done < length; done += chunk) {
+			std::size_t part = static_cast<std::size_t>(std::min(chunk, length - done));
+			std::size_t at = value.size();
+			value.resize(at + part);
+			str.read(reinterpret_cast<char*>(&value[at]), part * sizeof(Char));
+		}
+		return value;
+	}
+};
+
+//fixed leading part of a saved ring
+struct ring_header {
+	static constexpr std::uint32_t signature = 0x47524942;
+	static constexpr std::uint16_t current = 1;
+	std::uint32_t magic;
+	std::uint16_t version;
+	std::uint16_t reserved;
+	std::uint32_t key_tag;
+	std::uint32_t key_size;
+	std::uint32_t info_tag;
+	std::uint32_t info_size;
+	std::uint64_t count;
+};
+static_assert(sizeof(ring_header) == 32, "Ring header layout has to stay fixed.");
+
+#endif
@@ -0,0 +1,212 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef RING_QUEUE_HPP
+#define RING_QUEUE_HPP
+
+//dependencies
+#include <atomic>
+#include <new>
+#include <utility>
+#include "hazard_pointers.hpp"
+
+/*
+	Lock-free FIFO mode of the ring, for any number of producers and
+	consumers. Producers push behind the last element, consumers take
+	from the front, each by a single compare-and-swap on the element
+	links. Lock-free linking allows one link per swap, so elements are
+	chained forward only, after a dummy front element whose successor
+	is the first one queued. Elements taken from the front are freed
+	through hazard pointers, once no thread can still be reading them.
+	This is a Michael-Scott queue next to the ring, not a mode of it:
+	it shares neither the doubly linked Element nor any ring operation.
+	It can only pay off with producers and consumers on separate cores.
+	Measured on a single hardware thread, the mutex-guarded bi_ring is
+	faster (bench queue, about 29 against 15-18 Mops/s), and a win under
+	multi-core contention has not been shown yet.
+*/
+template <typename Key, typename Info>
+class ring_queue {
+public:
+	//(de)constructors
+	ring_queue(); //DONE
+	ring_queue(const ring_queue<Key, Info>& src) = delete;
+	~ring_queue(); //DONE
+
+	//operators
+	ring_queue<Key, Info>& operator=(const ring_queue<Key, Info>& src) = delete;
+
+	//insertion methods
+	void push(const Key& key, const Info& inf); //DONE
+	void push(Key key, Info&& inf); //DONE
+
+	//removal methods
+	//false when there was nothing to take
+	bool pop_front(Key& key, Info& inf); //DONE
+
+	//getter methods, exact only while no other thread changes the queue
+	bool empty() const; //DONE
+	unsigned int size() const; //DONE
+
+private:
+	struct Element {
+		std::atomic<Element*> next;
+		//the front dummy holds no payload
+		alignas(Key) unsigned char key[sizeof(Key)];
+		alignas(Info) unsigned char info[sizeof(Info)];
+		Element() : next(nullptr) {
+		}
+		Key& stored_key() {
+			return *std::launder(reinterpret_cast<Key*>(key));
+		}
+		Info& stored_info() {
+			return *std::launder(reinterpret_cast<Info*>(info));
+		}
+	};
+	//storage members
+	alignas(64) std::atomic<Element*> front;
+	alignas(64) std::atomic<Element*> back;
+	alignas(64) std::atomic<unsigned int> length;
+	//helper methods
+	void _append(Element* item); //DONE
+	static void _free(void* item); //DONE
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Key, typename Info>
+ring_queue<Key, Info>::ring_queue()
+	: length(0) {
+	Element* dummy = new Element;
+	front.store(dummy, std::memory_order_relaxed);
+	back.store(dummy, std::memory_order_relaxed);
+}
+
+template <typename Key, typename Info>
+ring_queue<Key, Info>::~ring_queue() {
+	Element* item = front.load(std::memory_order_relaxed);
+	Element* next = item -> next.load(std::memory_order_relaxed);
+	delete item;
+	for(item = next; item; item = next) {
+		next = item -> next.load(std::memory_order_relaxed);
+		item -> stored_key().~Key();
+		item -> stored_info().~Info();
+		delete item;
+	}
+}
+
+/*
+	INSERTION METHODS
+*/
+
+template <typename Key, typename Info>
+void ring_queue<Key, Info>::push(const Key& key, const Info& inf) {
+	Element* item = new Element;
+	new(item -> key) Key(key);
+	new(item -> info) Info(inf);
+	_append(item);
+}
+
+template <typename Key, typename Info>
+void ring_queue<Key, Info>::push(Key key, Info&& inf) {
+	Element* item = new Element;
+	new(item -> key) Key(std::move(key));
+	new(item -> info) Info(std::move(inf));
+	_append(item);
+}
+
+/*
+	REMOVAL METHODS
+*/
+
+template <typename Key, typename Info>
+bool ring_queue<Key, Info>::pop_front(Key& key, Info& inf) {
+	while(true) {
+		Element* first = hazard_pointers::protect(0, front);
+		Element* next = hazard_pointers::protect(1, first -> next);
+		if(first != front.load(std::memory_order_acquire)) {
+			continue;
+		}
+		if(next == nullptr) {
+			hazard_pointers::clear(0);
+			hazard_pointers::clear(1);
+			return false;
+		}
+		//never let the front pass the back, help a push that has not swung it yet
+		Element* last = back.load(std::memory_order_acquire);
+		if(first == last) {
+			back.compare_exchange_strong(last, next, std::memory_order_release,
+						     std::memory_order_relaxed);
+			continue;
+		}
+		if(front.compare_exchange_strong(first, next, std::memory_order_seq_cst,
+						 std::memory_order_relaxed)) {
+			//next is the new dummy, its payload is this thread's alone
+			key = std::move(next -> stored_key());
+			inf = std::move(next -> stored_info());
+			next -> stored_key().~Key();
+			next -> stored_info().~Info();
+			length.fetch_sub(1, std::memory_order_relaxed);
+			hazard_pointers::clear(0);
+			hazard_pointers::clear(1);
+			hazard_pointers::retire(first, &_free);
+			return true;
+		}
+	}
+}
+
+/*
+	GETTER METHODS
+*/
+
+template <typename Key, typename Info>
+bool ring_queue<Key, Info>::empty() const {
+	return !length.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename Info>
+unsigned int ring_queue<Key, Info>::size() const {
+	return length.load(std::memory_order_relaxed);
+}
+
+/*
+	HELPER METHODS
+*/
+
+template <typename Key, typename Info>
+void ring_queue<Key, Info>::_append(Element* item) {
+	length.fetch_add(1, std::memory_order_relaxed);
+	while(true) {
+		Element* last = hazard_pointers::protect(0, back);
+		Element* next = last -> next.load(std::memory_order_acquire);
+		if(last != back.load(std::memory_order_acquire)) {
+			continue;
+		}
+		//the back lags behind a finished push, move it on and retry
+		if(next != nullptr) {
+			back.compare_exchange_strong(last, next, std::memory_order_release,
+						     std::memory_order_relaxed);
+			continue;
+		}
+		if(last -> next.compare_exchange_strong(next, item, std::memory_order_release,
+							std::memory_order_relaxed)) {
+			back.compare_exchange_strong(last, item, std::memory_order_release,
+						     std::memory_order_relaxed);
+			hazard_pointers::clear(0);
+			return;
+		}
+	}
+}
+
+//frees a former dummy, its payload was moved out and destroyed already
+template <typename Key, typename Info>
+void ring_queue<Key, Info>::_free(void* item) {
+	delete static_cast<Element*>(item);
+}
+
+#endif
@@ -0,0 +1,461 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef SNAPSHOT_RING_HPP
+#define SNAPSHOT_RING_HPP
+
+//dependencies
+#include <atomic>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bi_ring.hpp"
+
+/*
+	Bi-directional ring for read-mostly sharing between threads.
+	Readers take no lock, they enter a read section and walk the ring
+	forward from the sentinel closing it. Writers serialize among
+	themselves, publish every relinking with a single pointer store and
+	never change an element in place, an update links in a changed copy.
+	Elements taken out of the ring are retired and only freed after a
+	grace period, once every read section that could still see them is
+	left, so a reader never touches freed memory. Each reader sees every
+	element that stays in the ring for its whole read section exactly
+	once, elements added or removed meanwhile at most once.
+*/
+template <typename Key, typename Info>
+class snapshot_bi_ring {
+	struct Link;
+	struct Element;
+public:
+	//(de)constructors
+	snapshot_bi_ring(); //DONE
+	snapshot_bi_ring(const snapshot_bi_ring<Key, Info>& src) = delete;
+	~snapshot_bi_ring(); //DONE
+
+	//operators
+	snapshot_bi_ring<Key, Info>& operator=(const snapshot_bi_ring<Key, Info>& src) = delete;
+
+	//read sections and iterators
+	class read_guard; //DONE
+	class const_iterator; //DONE
+	read_guard read() const; //DONE
+	//both only while a read_guard is held
+	const_iterator begin() const; //DONE
+	const_iterator end() const; //DONE
+
+	//writer methods, serialized among themselves
+	void push(const Key& key, const Info& inf); //DONE
+	bool update(const Key& key, const Info& inf, int n_key = 1); //DONE
+	bool remove(const Key& key, int n_key = 1); //DONE
+	bool purge(); //DONE
+	//waits until every retired element is freed
+	void synchronize(); //DONE
+
+	//reader methods, each in a read section of its own
+	bool empty() const; //DONE
+	unsigned int size() const; //DONE
+	Info get_info(const Key& key, int n_key = 1) const; //DONE
+	unsigned int count(const Key& key) const; //DONE
+
+private:
+	struct Link {
+		std::atomic<Link*> next;
+		//only followed by writers
+		Link* prev;
+	};
+	struct Element : Link {
+		const Key key;
+		const Info info;
+		Element(const Key& key, const Info& info)
+			: key(key), info(info) {
+		}
+	};
+	//storage members
+	Link head;
+	std::atomic<unsigned int> length;
+	std::mutex writer;
+	//readers are counted under the parity of the epoch they entered in
+	mutable std::atomic<unsigned int> epoch;
+	mutable std::atomic<unsigned int> readers[2];
+	//retired elements, by parity of the epoch they were retired in
+	std::vector<Element*> retired[2];
+	//helper methods
+	Element* _find(const Key& key, int n_key) const; //DONE
+	void _unlink(Element* item); //DONE
+	void _retire(Element* item); //DONE
+	void _advance(); //DONE
+};
+
+template <typename Key, typename Info>
+class snapshot_bi_ring<Key, Info>::read_guard {
+
+friend snapshot_bi_ring<Key, Info>;
+
+public:
+	read_guard(const read_guard& src) = delete;
+	read_guard(read_guard&& src); //DONE
+	~read_guard(); //DONE
+	read_guard& operator=(const read_guard& src) = delete;
+private:
+	const snapshot_bi_ring<Key, Info>* ring;
+	unsigned int parity;
+	explicit read_guard(const snapshot_bi_ring<Key, Info>& of); //DONE
+};
+
+template <typename Key, typename Info>
+class snapshot_bi_ring<Key, Info>::const_iterator {
+
+friend snapshot_bi_ring<Key, Info>;
+
+public:
+	using iterator_category = std::forward_iterator_tag;
+	using value_type = Info;
+	using difference_type = std::ptrdiff_t;
+	using pointer = const Info*;
+	using reference = const Info&;
+
+	const_iterator(); //DONE
+
+	const_iterator& operator++(); //DONE
+	const_iterator operator++(int); //DONE
+	const Info& operator*() const; //DONE
+	bool operator==(const const_iterator& itr) const; //DONE
+	bool operator!=(const const_iterator& itr) const; //DONE
+
+	//custom getters
+	const Key& key() const; //DONE
+	const Info& info() const; //DONE
+	bool valid() const; //DONE
+private:
+	const Link* current;
+	const Link* stop;
+	const_iterator(const Link* at, const Link* sentinel); //DONE
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::snapshot_bi_ring()
+	: length(0), epoch(0) {
+	head.next.store(&head, std::memory_order_relaxed);
+	head.prev = &head;
+	readers[0].store(0, std::memory_order_relaxed);
+	readers[1].store(0, std::memory_order_relaxed);
+}
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::~snapshot_bi_ring() {
+	//no reader may outlive the ring, so everything goes at once
+	Link* item = head.next.load(std::memory_order_relaxed);
+	while(item != &head) {
+		Link* next = item -> next.load(std::memory_order_relaxed);
+		delete static_cast<Element*>(item);
+		item = next;
+	}
+	for(std::vector<Element*>& list : retired) {
+		for(Element* old : list) {
+			delete old;
+		}
+	}
+}
+
+/*
+	READ SECTIONS AND ITERATORS
+*/
+
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::read_guard
+snapshot_bi_ring<Key, Info>::read() const {
+	return read_guard(*this);
+}
+
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::const_iterator
+snapshot_bi_ring<Key, Info>::begin() const {
+	return const_iterator(head.next.load(std::memory_order_acquire), &head);
+}
+
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::const_iterator
+snapshot_bi_ring<Key, Info>::end() const {
+	return const_iterator(&head, &head);
+}
+
+/*
+	WRITER METHODS
+*/
+
+template <typename Key, typename Info>
+void snapshot_bi_ring<Key, Info>::push(const Key& key, const Info& inf) {
+	Element* item = new Element(key, inf);
+	std::lock_guard<std::mutex> guard(writer);
+	Link* last = head.prev;
+	item -> next.store(&head, std::memory_order_relaxed);
+	item -> prev = last;
+	//readers see the element complete or not at all
+	last -> next.store(item, std::memory_order_release);
+	head.prev = item;
+	length++;
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::update(const Key& key, const Info& inf, int n_key) {
+	std::lock_guard<std::mutex> guard(writer);
+	Element* old = _find(key, n_key);
+	if(old == nullptr) {
+		return false;
+	}
+	//readers holding the old element keep it, later ones get the copy
+	Element* item = new Element(old -> key, inf);
+	Link* next = old -> next.load(std::memory_order_relaxed);
+	item -> next.store(next, std::memory_order_relaxed);
+	item -> prev = old -> prev;
+	old -> prev -> next.store(item, std::memory_order_release);
+	next -> prev = item;
+	_retire(old);
+	return true;
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::remove(const Key& key, int n_key) {
+	std::lock_guard<std::mutex> guard(writer);
+	Element* item = _find(key, n_key);
+	if(item == nullptr) {
+		return false;
+	}
+	_unlink(item);
+	_retire(item);
+	return true;
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::purge() {
+	std::lock_guard<std::mutex> guard(writer);
+	Link* item = head.next.load(std::memory_order_relaxed);
+	if(item == &head) {
+		return false;
+	}
+	//cut the whole chain off at once, its links stay for readers inside it
+	head.next.store(&head, std::memory_order_release);
+	head.prev = &head;
+	length = 0;
+	while(item != &head) {
+		Link* next = item -> next.load(std::memory_order_relaxed);
+		retired[epoch.load() & 1].push_back(static_cast<Element*>(item));
+		item = next;
+	}
+	_advance();
+	return true;
+}
+
+template <typename Key, typename Info>
+void snapshot_bi_ring<Key, Info>::synchronize() {
+	while(true) {
+		{
+			std::lock_guard<std::mutex> guard(writer);
+			_advance();
+			if(retired[0].empty() && retired[1].empty()) {
+				return;
+			}
+		}
+		std::this_thread::yield();
+	}
+}
+
+/*
+	READER METHODS
+*/
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::empty() const {
+	return !length;
+}
+
+template <typename Key, typename Info>
+unsigned int snapshot_bi_ring<Key, Info>::size() const {
+	return length;
+}
+
+template <typename Key, typename Info>
+Info snapshot_bi_ring<Key, Info>::get_info(const Key& key, int n_key) const {
+	read_guard guard(*this);
+	Element* result = _find(key, n_key);
+	if(result != nullptr) {
+		return result -> info;
+	}
+	throw std::invalid_argument("Specified key not found");
+}
+
+template <typename Key, typename Info>
+unsigned int snapshot_bi_ring<Key, Info>::count(const Key& key) const {
+	read_guard guard(*this);
+	unsigned int n_ocr = 0;
+	for(const_iterator itr = begin(); itr != end(); ++itr) {
+		if(itr.key() == key) {
+			n_ocr++;
+		}
+	}
+	return n_ocr;
+}
+
+/*
+	HELPER METHODS
+*/
+
+//n_key-th occurrence of key, inside a read section or under the writer lock
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::Element*
+snapshot_bi_ring<Key, Info>::_find(const Key& key, int n_key) const {
+	if(n_key < 1) {
+		return nullptr;
+	}
+	for(const Link* current = head.next.load(std::memory_order_acquire); current != &head;
+	    current = current -> next.load(std::memory_order_acquire)) {
+		const Element* item = static_cast<const Element*>(current);
+		if(item -> key == key && !--n_key) {
+			return const_cast<Element*>(item);
+		}
+	}
+	return nullptr;
+}
+
+//takes item out, its own next link stays for readers standing on it
+template <typename Key, typename Info>
+void snapshot_bi_ring<Key, Info>::_unlink(Element* item) {
+	Link* next = item -> next.load(std::memory_order_relaxed);
+	item -> prev -> next.store(next, std::memory_order_release);
+	next -> prev = item -> prev;
+	length--;
+}
+
+template <typename Key, typename Info>
+void snapshot_bi_ring<Key, Info>::_retire(Element* item) {
+	retired[epoch.load() & 1].push_back(item);
+	_advance();
+}
+
+//frees what the previous epoch retired once its readers are gone, then moves on
+template <typename Key, typename Info>
+void snapshot_bi_ring<Key, Info>::_advance() {
+	unsigned int now = epoch.load();
+	unsigned int last = (now + 1) & 1;
+	if(readers[last].load()) {
+		return;
+	}
+	for(Element* old : retired[last]) {
+		delete old;
+	}
+	retired[last].clear();
+	//readers entering from here on count under the parity just emptied
+	epoch.store(now + 1);
+}
+
+/*
+	READ GUARD
+*/
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::read_guard::read_guard(const snapshot_bi_ring<Key, Info>& of)
+	: ring(&of) {
+	//count in under the current epoch, retry if it moved on meanwhile
+	while(true) {
+		unsigned int seen = ring -> epoch.load();
+		parity = seen & 1;
+		ring -> readers[parity].fetch_add(1);
+		if(ring -> epoch.load() == seen) {
+			return;
+		}
+		ring -> readers[parity].fetch_sub(1);
+	}
+}
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::read_guard::read_guard(read_guard&& src)
+	: ring(src.ring), parity(src.parity) {
+	src.ring = nullptr;
+}
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::read_guard::~read_guard() {
+	if(ring != nullptr) {
+		ring -> readers[parity].fetch_sub(1);
+	}
+}
+
+/*
+	ITERATOR
+*/
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::const_iterator::const_iterator()
+	: current(nullptr), stop(nullptr) {
+}
+
+template <typename Key, typename Info>
+snapshot_bi_ring<Key, Info>::const_iterator::const_iterator(const Link* at, const Link* sentinel)
+	: current(at), stop(sentinel) {
+}
+
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::const_iterator&
+snapshot_bi_ring<Key, Info>::const_iterator::operator++() {
+	if(iterator_checks::enabled && (current == nullptr || current == stop)) {
+		throw std::domain_error(nulldef_exc);
+	}
+	current = current -> next.load(std::memory_order_acquire);
+	return *this;
+}
+
+template <typename Key, typename Info>
+typename snapshot_bi_ring<Key, Info>::const_iterator
+snapshot_bi_ring<Key, Info>::const_iterator::operator++(int) {
+	const_iterator prev(*this);
+	++(*this);
+	return prev;
+}
+
+template <typename Key, typename Info>
+const Info& snapshot_bi_ring<Key, Info>::const_iterator::operator*() const {
+	return info();
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::const_iterator::operator==(const const_iterator& cmp) const {
+	return current == cmp.current;
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::const_iterator::operator!=(const const_iterator& cmp) const {
+	return !(*this == cmp);
+}
+
+template <typename Key, typename Info>
+const Key& snapshot_bi_ring<Key, Info>::const_iterator::key() const {
+	if(iterator_checks::enabled && !valid()) {
+		throw std::domain_error(nulldef_exc);
+	}
+	return static_cast<const Element*>(current) -> key;
+}
+
+template <typename Key, typename Info>
+const Info& snapshot_bi_ring<Key, Info>::const_iterator::info() const {
+	if(iterator_checks::enabled && !valid()) {
+		throw std::domain_error(nulldef_exc);
+	}
+	return static_cast<const Element*>(current) -> info;
+}
+
+template <typename Key, typename Info>
+bool snapshot_bi_ring<Key, Info>::const_iterator::valid() const {
+	return current != nullptr && current != stop;
+}
+
+#endif
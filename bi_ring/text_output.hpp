@@ -0,0 +1,149 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef TEXT_OUTPUT_HPP
+#define TEXT_OUTPUT_HPP
+
+//dependencies
+#include <charconv>
+#include <cstddef>
+#include <cstring>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+
+/*
+	Buffered text formatting in front of an output stream.
+	Text collects in a fixed buffer that goes to the stream in large
+	writes, once full and on flush(). Numbers are formatted in place
+	with std::to_chars and character strings are copied as they are,
+	as long as the stream was at its default formatting when output
+	began, which to_chars reproduces exactly. Other values, and all of
+	them for a stream with flags or a width set, are inserted through
+	the stream itself after the buffered text, so the output is the same.
+*/
+class text_output {
+public:
+	//(de)constructors
+	explicit text_output(std::ostream& str);
+	text_output(const text_output& src) = delete;
+
+	//operators
+	text_output& operator=(const text_output& src) = delete;
+	text_output& operator<<(char sign);
+	text_output& operator<<(std::string_view text);
+	template <typename T>
+	text_output& operator<<(const T& value);
+
+	//hands the buffered text over to the stream
+	void flush();
+
+private:
+	static constexpr std::size_t capacity = 1 << 14;
+	//longest number to_chars produces, a double in general notation
+	static constexpr std::size_t number_room = 32;
+	//storage members
+	std::ostream& str;
+	bool plain;
+	std::size_t used;
+	char buffer[capacity];
+	//helper methods
+	char* _reserve(std::size_t size);
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+inline text_output::text_output(std::ostream& str)
+	: str(str), used(0) {
+	plain = str.flags() == (std::ios_base::dec | std::ios_base::skipws) && !str.width();
+}
+
+/*
+	OPERATORS
+*/
+
+inline text_output& text_output::operator<<(char sign) {
+	if(!plain) {
+		flush();
+		str << sign;
+		return *this;
+	}
+	*_reserve(1) = sign;
+	used++;
+	return *this;
+}
+
+inline text_output& text_output::operator<<(std::string_view text) {
+	if(!plain) {
+		flush();
+		str << text;
+		return *this;
+	}
+	//longer than the buffer, write around it
+	if(text.size() > capacity) {
+		flush();
+		str.write(text.data(), static_cast<std::streamsize>(text.size()));
+		return *this;
+	}
+	std::memcpy(_reserve(text.size()), text.data(), text.size());
+	used += text.size();
+	return *this;
+}
+
+template <typename T>
+text_output& text_output::operator<<(const T& value) {
+	//characters and bools print as such, not as numbers
+	constexpr bool number = std::is_arithmetic<T>::value && !std::is_same<T, bool>::value &&
+				!std::is_same<T, char>::value && !std::is_same<T, signed char>::value &&
+				!std::is_same<T, unsigned char>::value;
+	if constexpr(number) {
+		if(plain) {
+			char* at = _reserve(number_room);
+			std::to_chars_result done;
+			if constexpr(std::is_floating_point<T>::value) {
+				//the stream default matches printf %g at the stream precision
+				done = std::to_chars(at, at + number_room, value, std::chars_format::general,
+						     static_cast<int>(str.precision()));
+			}
+			else {
+				done = std::to_chars(at, at + number_room, value);
+			}
+			if(done.ec == std::errc()) {
+				used += done.ptr - at;
+				return *this;
+			}
+		}
+	}
+	else if constexpr(std::is_convertible<const T&, std::string_view>::value) {
+		return *this << std::string_view(value);
+	}
+	flush();
+	str << value;
+	return *this;
+}
+
+/*
+	BUFFER MANAGEMENT
+*/
+
+inline void text_output::flush() {
+	if(used) {
+		str.write(buffer, static_cast<std::streamsize>(used));
+		used = 0;
+	}
+}
+
+//room for size more characters, writing the buffer out first when short of it
+inline char* text_output::_reserve(std::size_t size) {
+	if(capacity - used < size) {
+		flush();
+	}
+	return buffer + used;
+}
+
+#endif
@@ -0,0 +1,175 @@
+/*
+	Authored by
+	Artur Sebastian Miller
+	Oct, 2026
+*/
+
+#ifndef THREAD_POOL_HPP
+#define THREAD_POOL_HPP
+
+//dependencies
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/*
+	Fixed set of worker threads running fork-join batches of tasks.
+	run() hands out task numbers to the workers and the calling thread
+	alike and returns once every task finished, rethrowing the first
+	exception a task threw. One batch runs at a time, a batch started
+	while another one is running, from a task included, runs all of its
+	tasks on the calling thread instead.
+*/
+class thread_pool {
+public:
+	//(de)constructors
+	explicit thread_pool(unsigned int threads = std::thread::hardware_concurrency());
+	thread_pool(const thread_pool& src) = delete;
+	~thread_pool();
+
+	//operators
+	thread_pool& operator=(const thread_pool& src) = delete;
+
+	//task methods
+	//calls task(i) for every i below count
+	template <typename Task>
+	void run(unsigned int count, Task&& task);
+
+	//getter methods
+	//threads taking part in a batch, the caller included
+	unsigned int size() const;
+	static thread_pool& shared();
+
+private:
+	//storage members
+	std::vector<std::thread> workers;
+	std::mutex lock;
+	std::condition_variable wake;
+	std::condition_variable finished;
+	std::atomic<bool> busy;
+	std::function<void(unsigned int)> job;
+	unsigned int tasks;
+	std::atomic<unsigned int> next;
+	unsigned int working;
+	unsigned long long batch;
+	bool stopping;
+	std::exception_ptr failure;
+	//helper methods
+	void _work();
+	void _drain();
+};
+
+/*
+	(DE)CONSTRUCTORS
+*/
+
+inline thread_pool::thread_pool(unsigned int threads)
+	: busy(false), tasks(0), next(0), working(0), batch(0), stopping(false) {
+	//the caller takes part, so one thread less is started
+	for(unsigned int i = 1; i < std::max(threads, 1u); i++) {
+		workers.emplace_back(&thread_pool::_work, this);
+	}
+}
+
+inline thread_pool::~thread_pool() {
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		stopping = true;
+	}
+	wake.notify_all();
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+}
+
+/*
+	TASK METHODS
+*/
+
+template <typename Task>
+void thread_pool::run(unsigned int count, Task&& task) {
+	bool idle = false;
+	if(workers.empty() || count < 2 || !busy.compare_exchange_strong(idle, true)) {
+		for(unsigned int i = 0; i < count; i++) {
+			task(i);
+		}
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> guard(lock);
+		job = std::ref(task);
+		tasks = count;
+		next = 0;
+		working = static_cast<unsigned int>(workers.size());
+		failure = nullptr;
+		batch++;
+	}
+	wake.notify_all();
+	_drain();
+	std::unique_lock<std::mutex> guard(lock);
+	finished.wait(guard, [this] { return !working; });
+	job = nullptr;
+	std::exception_ptr thrown = failure;
+	guard.unlock();
+	busy = false;
+	if(thrown) {
+		std::rethrow_exception(thrown);
+	}
+}
+
+/*
+	GETTER METHODS
+*/
+
+inline unsigned int thread_pool::size() const {
+	return static_cast<unsigned int>(workers.size()) + 1;
+}
+
+inline thread_pool& thread_pool::shared() {
+	static thread_pool pool;
+	return pool;
+}
+
+/*
+	HELPER METHODS
+*/
+
+inline void thread_pool::_work() {
+	unsigned long long seen = 0;
+	std::unique_lock<std::mutex> guard(lock);
+	while(true) {
+		wake.wait(guard, [&] { return stopping || batch != seen; });
+		if(stopping) {
+			return;
+		}
+		seen = batch;
+		guard.unlock();
+		_drain();
+		guard.lock();
+		if(!--working) {
+			finished.notify_one();
+		}
+	}
+}
+
+//takes tasks of the running batch until none are left
+inline void thread_pool::_drain() {
+	for(unsigned int i = next++; i < tasks; i = next++) {
+		try {
+			job(i);
+		}
+		catch(...) {
+			std::lock_guard<std::mutex> guard(lock);
+			if(!failure) {
+				failure = std::current_exception();
+			}
+		}
+	}
+}
+
+#endif
@@ -1,32 +1,52 @@
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <memory_resource>
+#include <numeric>
 #include <sstream>
+#include <stdexcept>
 #include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <gtest/gtest.h>
 #include "bi_ring.hpp"
+#include "bi_ring_unrolled.hpp"
+#include "bi_ring_buffer.hpp"
+#include "interleave_view.hpp"
+#include "concurrent_bi_ring.hpp"
+#include "ring_queue.hpp"
+#include "snapshot_bi_ring.hpp"
 
 #define loop_up(startpoint, endpoint) for(int i = startpoint; i < endpoint; i++)
 #define loop_dn(startpoint, endpoint) for(int i = startpoint; i > endpoint; i--)
 
+template <typename Ring>
 class RingTests : public ::testing::Test {
 public:
-	bi_ring<int, int>* t0;
-	bi_ring<int, int>* t1;
-	bi_ring<int, int>* t2;
-	bi_ring<int, int>::const_iterator* itr_v;
-	bi_ring<int, int>::const_iterator* itr_e;
+	Ring* t0;
+	Ring* t1;
+	Ring* t2;
+	typename Ring::const_iterator* itr_v;
+	typename Ring::const_iterator* itr_e;
 	void SetUp() {
-		t0 = new bi_ring<int, int>;
-		t1 = new bi_ring<int, int>(0, 1);
+		t0 = new Ring;
+		t1 = new Ring(0, 1);
 		loop_up(0, 9) {
 			t1 -> push(i+1, i+2);
 		}
-		t2 = new bi_ring<int, int>(*t1);
-		bi_ring<int, int>::iterator itr1(*t2, 9);
-		bi_ring<int, int>::iterator itr2(*t2, 1);
+		t2 = new Ring(*t1);
+		typename Ring::iterator itr1(*t2, 9);
+		typename Ring::iterator itr2(*t2, 1);
 		t2 -> swap(itr1, itr2);
 		t2 -> push(2, 5);
-		itr_v = new bi_ring<int, int>::const_iterator(*t1);
-		itr_e = new bi_ring<int, int>::const_iterator(*t2);
+		itr_v = new typename Ring::const_iterator(*t1);
+		itr_e = new typename Ring::const_iterator(*t2);
 	}
 	void TearDown() {
 		delete t0;
@@ -37,51 +57,66 @@ public:
 	}
 };
 
-TEST_F(RingTests, Constructor) {
-	EXPECT_EQ(0, t0 -> size());
+//every backend has to pass the common interface tests
+using Backends = ::testing::Types<bi_ring<int, int>, bi_ring_unrolled<int, int, 4>,
+				  bi_ring_buffer<int, int>>;
+TYPED_TEST_SUITE(RingTests, Backends);
+
+//alternative backends are checked against the linked ring
+template <typename Ring>
+class BackendTests : public ::testing::Test {
+};
+
+using AltBackends = ::testing::Types<bi_ring_unrolled<int, int, 4>, bi_ring_buffer<int, int>>;
+TYPED_TEST_SUITE(BackendTests, AltBackends);
+
+using BiRingTests = RingTests<bi_ring<int, int>>;
+
+TYPED_TEST(RingTests, Constructor) {
+	EXPECT_EQ(0, this -> t0 -> size());
 }
 
-TEST_F(RingTests, InitConstructor) {
-	EXPECT_EQ(9, t1 -> get_info(8));
+TYPED_TEST(RingTests, InitConstructor) {
+	EXPECT_EQ(9, this -> t1 -> get_info(8));
 }
 
-TEST_F(RingTests, CopyConstructor) {
-	EXPECT_EQ(11, t2 -> size());
+TYPED_TEST(RingTests, CopyConstructor) {
+	EXPECT_EQ(11, this -> t2 -> size());
 }
 
-TEST_F(RingTests, OperatorEquality) {
-	bi_ring<int, int> newRing(*t1);
-	bi_ring<int, int> emptyRing;
-	EXPECT_EQ(newRing == *t1, true);
-	EXPECT_EQ(newRing == *t2, false);
-	EXPECT_EQ(*t2 == *t2, true);
-	EXPECT_EQ(emptyRing == *t0, true);
+TYPED_TEST(RingTests, OperatorEquality) {
+	TypeParam newRing(*this -> t1);
+	TypeParam emptyRing;
+	EXPECT_EQ(newRing == *this -> t1, true);
+	EXPECT_EQ(newRing == *this -> t2, false);
+	EXPECT_EQ(*this -> t2 == *this -> t2, true);
+	EXPECT_EQ(emptyRing == *this -> t0, true);
 }
 
-TEST_F(RingTests, OperatorInequality) {
-	bi_ring<int, int> newRing(*t1);
-	bi_ring<int, int> emptyRing;
-	EXPECT_EQ(newRing != *t1, false);
-	EXPECT_EQ(newRing != *t2, true);
-	EXPECT_EQ(*t2 != *t2, false);
-	EXPECT_EQ(emptyRing != *t0, false);
+TYPED_TEST(RingTests, OperatorInequality) {
+	TypeParam newRing(*this -> t1);
+	TypeParam emptyRing;
+	EXPECT_EQ(newRing != *this -> t1, false);
+	EXPECT_EQ(newRing != *this -> t2, true);
+	EXPECT_EQ(*this -> t2 != *this -> t2, false);
+	EXPECT_EQ(emptyRing != *this -> t0, false);
 }
 
-TEST_F(RingTests, OperatorAssignment) {
-	bi_ring<int, int> newRing;
-	newRing = *t1;
-	EXPECT_EQ(newRing, *t1);
+TYPED_TEST(RingTests, OperatorAssignment) {
+	TypeParam newRing;
+	newRing = *this -> t1;
+	EXPECT_EQ(newRing, *this -> t1);
 	newRing = newRing;
 	EXPECT_NE(0, newRing.size());
 }
 
-TEST_F(RingTests, OperatorAddition) {
-	bi_ring<int, int> newRing;
+TYPED_TEST(RingTests, OperatorAddition) {
+	TypeParam newRing;
 	loop_up(10, 19) {
 		newRing.push(i, i+1);
 	}
-	newRing = *t1 + newRing;
-	bi_ring<int, int>::const_iterator itr(newRing);
+	newRing = *this -> t1 + newRing;
+	typename TypeParam::const_iterator itr(newRing);
 	loop_up(0, 19) {
 		EXPECT_EQ(itr.key(), i);
 		EXPECT_EQ(itr.info(), i+1);
@@ -89,41 +124,67 @@ TEST_F(RingTests, OperatorAddition) {
 	}
 }
 
-TEST_F(RingTests, OperatorAdditionAssignment) {
+TYPED_TEST(RingTests, OperatorAdditionAssignment) {
 	//create a new ring
-	bi_ring<int, int> newRing;
+	TypeParam newRing;
 	loop_up(10, 19) {
 		newRing.push(i, i+1);
 	}
 	//sum up ring from fixture with new
-	*t1 += newRing;
+	*this -> t1 += newRing;
 	//check every element of the newly modified one
-	bi_ring<int, int>::const_iterator itr(*t1);
+	typename TypeParam::const_iterator itr(*this -> t1);
+	loop_up(0, 19) {
+		EXPECT_EQ(itr.key(), i);
+		EXPECT_EQ(itr.info(), i+1);
+		itr++;
+	}
+}
+
+TYPED_TEST(RingTests, OperatorAdditionRvalue) {
+	TypeParam tail;
+	loop_up(10, 19) {
+		tail.push(i, i+1);
+	}
+	TypeParam head(*this -> t1);
+	//temporaries on either side give up their elements
+	TypeParam joined = std::move(head) + TypeParam(tail);
+	EXPECT_EQ(joined.size(), 19);
+	joined = *this -> t1 + std::move(tail);
+	EXPECT_TRUE(tail.empty());
+	typename TypeParam::const_iterator itr(joined);
 	loop_up(0, 19) {
 		EXPECT_EQ(itr.key(), i);
 		EXPECT_EQ(itr.info(), i+1);
 		itr++;
 	}
+	//appending a ring to itself doubles it
+	joined += std::move(joined);
+	EXPECT_EQ(joined.size(), 38);
+	EXPECT_EQ(joined.get_info(18, 2), 19);
+	*this -> t0 += std::move(joined);
+	EXPECT_EQ(*this -> t0 + TypeParam(), *this -> t0);
+	EXPECT_EQ(this -> t0 -> size(), 38);
 }
 
-TEST_F(RingTests, OperatorInsertion) {
+TYPED_TEST(RingTests, OperatorInsertion) {
 	//insert into the custom stream and compare output
 	std::stringstream str;
-	str << *t1;
+	str << *this -> t1;
 	std::string output = str.str();
 	EXPECT_EQ(output, "[0] 1\n[1] 2\n[2] 3\n[3] 4\n[4] 5\n[5] 6\n[6] 7\n[7] 8\n[8] 9\n[9] 10\n");
 }
 
-TEST_F(RingTests, Push) {
+TYPED_TEST(RingTests, Push) {
 	//push and check if successful
-	t0 -> push(1, 5);
-	EXPECT_EQ(5, t0 -> get_info(1));
+	this -> t0 -> push(1, 5);
+	EXPECT_EQ(5, this -> t0 -> get_info(1));
 }
 
-TEST_F(RingTests, InsertAfter) {
+TYPED_TEST(RingTests, InsertAfter) {
 	//one-element case
-	bi_ring<int, int> oneElement(1, 9);
-	bi_ring<int, int>::iterator itr1(oneElement, 1);
+	TypeParam oneElement(1, 9);
+	typename TypeParam::iterator itr1(oneElement, 1);
 	itr1 = oneElement.insert_after(5, 6, itr1);
 	EXPECT_EQ(5, itr1.key());
 	EXPECT_EQ(6, itr1.info());
@@ -131,339 +192,1711 @@ TEST_F(RingTests, InsertAfter) {
 	EXPECT_EQ(1, itr1.key());
 	EXPECT_EQ(9, itr1.info());
 	//multiple elements
-	bi_ring<int, int>::iterator itr2(*t1, 1);
-	itr2 = t1 -> insert_after(5, 6, itr2);
+	typename TypeParam::iterator itr2(*this -> t1, 1);
+	itr2 = this -> t1 -> insert_after(5, 6, itr2);
 	EXPECT_EQ(5, itr2.key());
 	EXPECT_EQ(6, itr2.info());
 	itr2--;
 	EXPECT_EQ(1, itr2.key());
 	EXPECT_EQ(2, itr2.info());
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
-		t1 -> insert_after(5, 6, empty);
+		this -> t1 -> insert_after(5, 6, empty);
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, InsertBefore) {
+TYPED_TEST(RingTests, InsertBefore) {
 	//insert and check next element after new
-	bi_ring<int, int>::iterator itr(*t1, 1);
-	itr = t1 -> insert_before(54, 49, itr);
+	typename TypeParam::iterator itr(*this -> t1, 1);
+	itr = this -> t1 -> insert_before(54, 49, itr);
 	EXPECT_EQ(54, itr.key());
 	EXPECT_EQ(49, itr.info());
 	itr++;
 	EXPECT_EQ(1, itr.key());
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
-		t1 -> insert_before(5, 6, empty);
+		this -> t1 -> insert_before(5, 6, empty);
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, Replace) {
+TYPED_TEST(RingTests, Replace) {
 	//check if replace was successful
-	bi_ring<int, int>::iterator itr(*t1, 5);
-	t1 -> replace(60, 70, itr);
+	typename TypeParam::iterator itr(*this -> t1, 5);
+	this -> t1 -> replace(60, 70, itr);
 	EXPECT_EQ(60, itr.key());
 	EXPECT_EQ(70, itr.info());
 	//check return
-	bi_ring<int, int>::const_iterator empty;
-	EXPECT_FALSE(t1 -> replace(5, 6, empty));
+	typename TypeParam::const_iterator empty;
+	EXPECT_FALSE(this -> t1 -> replace(5, 6, empty));
 }
 
-TEST_F(RingTests, Purge) {
+TYPED_TEST(RingTests, Purge) {
 	//clean the whole list
-	t1 -> purge();
-	EXPECT_EQ(0, t1 -> size());
-	EXPECT_EQ(false, t0 -> purge());
+	this -> t1 -> purge();
+	EXPECT_EQ(0, this -> t1 -> size());
+	EXPECT_EQ(false, this -> t0 -> purge());
 }
 
-TEST_F(RingTests, RemoveAfter) {
+TYPED_TEST(RingTests, RemoveAfter) {
 	//ordinary element in multi-element ring
-	bi_ring<int, int>::iterator itr(*t1, 0);
-	itr = t1 -> remove_after(itr);
+	typename TypeParam::iterator itr(*this -> t1, 0);
+	itr = this -> t1 -> remove_after(itr);
 	EXPECT_EQ(itr.key(), 2);
 	//one element case
-	t0 -> push(5, 7);
-	bi_ring<int, int>::iterator itr2(*t0, 5);
-	itr2 = t0 -> remove_after(itr2);
+	this -> t0 -> push(5, 7);
+	typename TypeParam::iterator itr2(*this -> t0, 5);
+	itr2 = this -> t0 -> remove_after(itr2);
 	EXPECT_EQ(itr2.valid(), false);
-	EXPECT_EQ(t0 -> empty(), true);
+	EXPECT_EQ(this -> t0 -> empty(), true);
 	//remove any in multi-element ring
-	itr = bi_ring<int, int>::iterator(*t1, 9);
-	itr = t1 -> remove_after(itr);
+	itr = typename TypeParam::iterator(*this -> t1, 9);
+	itr = this -> t1 -> remove_after(itr);
 	EXPECT_EQ(itr.valid(), true);
 	std::stringstream str;
-	str << *t1;
+	str << *this -> t1;
 	std::string output = str.str();
 	EXPECT_EQ(output, "[2] 3\n[3] 4\n[4] 5\n[5] 6\n[6] 7\n[7] 8\n[8] 9\n[9] 10\n");
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
-		t1 -> remove_after(empty);
+		this -> t1 -> remove_after(empty);
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, RemoveBefore) {
+TYPED_TEST(RingTests, RemoveBefore) {
 	//ordinary element in multi-element ring
-	bi_ring<int, int>::iterator itr(*t1, 6);
-	itr = t1 -> remove_before(itr);
+	typename TypeParam::iterator itr(*this -> t1, 6);
+	itr = this -> t1 -> remove_before(itr);
 	EXPECT_EQ(itr.key(), 6);
 	//one element case
-	t0 -> push(5, 7);
-	bi_ring<int, int>::iterator itr2(*t0, 5);
-	itr2 = t0 -> remove_before(itr2);
+	this -> t0 -> push(5, 7);
+	typename TypeParam::iterator itr2(*this -> t0, 5);
+	itr2 = this -> t0 -> remove_before(itr2);
 	EXPECT_EQ(itr2.valid(), false);
-	EXPECT_EQ(t0 -> empty(), true);
+	EXPECT_EQ(this -> t0 -> empty(), true);
 	//remove any in multi-element ring
-	itr = bi_ring<int, int>::iterator(*t1, 1);
-	itr = t1 -> remove_before(itr);
+	itr = typename TypeParam::iterator(*this -> t1, 1);
+	itr = this -> t1 -> remove_before(itr);
 	EXPECT_EQ(itr.valid(), true);
 	std::stringstream str;
-	str << *t1;
+	str << *this -> t1;
 	std::string output = str.str();
 	EXPECT_EQ(output, "[1] 2\n[2] 3\n[3] 4\n[4] 5\n[6] 7\n[7] 8\n[8] 9\n[9] 10\n");
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
-		t1 -> remove_before(empty);
+		this -> t1 -> remove_before(empty);
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, Remove) {
+TYPED_TEST(RingTests, Remove) {
 	//ordinary element in multi-element ring
-	bi_ring<int, int>::iterator itr(*t1, 6);
-	itr = t1 -> remove(itr);
+	typename TypeParam::iterator itr(*this -> t1, 6);
+	itr = this -> t1 -> remove(itr);
 	EXPECT_EQ(itr.key(), 7);
 	//one element case
-	t0 -> push(5, 7);
-	bi_ring<int, int>::iterator itr2(*t0, 5);
-	itr2 = t0 -> remove(itr2);
+	this -> t0 -> push(5, 7);
+	typename TypeParam::iterator itr2(*this -> t0, 5);
+	itr2 = this -> t0 -> remove(itr2);
 	EXPECT_EQ(itr2.valid(), false);
-	EXPECT_EQ(t0 -> empty(), true);
+	EXPECT_EQ(this -> t0 -> empty(), true);
 	//remove any in multi-element ring
-	itr = bi_ring<int, int>::iterator(*t1, 0);
-	itr = t1 -> remove(itr);
+	itr = typename TypeParam::iterator(*this -> t1, 0);
+	itr = this -> t1 -> remove(itr);
 	EXPECT_EQ(itr.valid(), true);
 	std::stringstream str;
-	str << *t1;
+	str << *this -> t1;
 	std::string output = str.str();
 	EXPECT_EQ(output, 
 	"[1] 2\n[2] 3\n[3] 4\n[4] 5\n[5] 6\n[7] 8\n[8] 9\n[9] 10\n");
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
-		t1 -> remove(empty);
+		this -> t1 -> remove(empty);
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, Empty) {
-	EXPECT_EQ(t0 -> empty(), true);
-	EXPECT_EQ(t1 -> empty(), false);
+//payload counting its copies and moves
+struct Tracked {
+	static int copies;
+	static int moves;
+	std::string text;
+	Tracked(const char* str) : text(str) {}
+	Tracked(const std::string& str, int times) {
+		loop_up(0, times) {
+			text += str;
+		}
+	}
+	Tracked(const Tracked& src) : text(src.text) { copies++; }
+	Tracked(Tracked&& src) noexcept : text(std::move(src.text)) { moves++; }
+	Tracked& operator=(const Tracked& src) { text = src.text; copies++; return *this; }
+	Tracked& operator=(Tracked&& src) noexcept { text = std::move(src.text); moves++; return *this; }
+	bool operator==(const Tracked& cmp) const { return text == cmp.text; }
+};
+int Tracked::copies = 0;
+int Tracked::moves = 0;
+
+template <typename Ring>
+class PayloadTests : public ::testing::Test {};
+
+using PayloadBackends = ::testing::Types<bi_ring<int, Tracked>, bi_ring_unrolled<int, Tracked, 4>,
+					 bi_ring_buffer<int, Tracked>>;
+TYPED_TEST_SUITE(PayloadTests, PayloadBackends);
+
+TYPED_TEST(PayloadTests, NoCopies) {
+	Tracked::copies = 0;
+	TypeParam ring;
+	typename TypeParam::iterator itr = ring.push(0, Tracked("zero"));
+	loop_up(1, 40) {
+		Tracked payload("moved");
+		switch(i % 5) {
+		case 0: itr = ring.push(i, std::move(payload)); break;
+		case 1: itr = ring.insert_after(i, std::move(payload), itr); break;
+		case 2: itr = ring.insert_before(i, std::move(payload), itr); break;
+		case 3: itr = ring.emplace_after(itr, i, "built", 3); break;
+		default: itr = ring.emplace_before(itr, i, "built"); break;
+		}
+	}
+	ring.emplace(40, "built", 2);
+	ring.replace(41, Tracked("replaced"), itr);
+	ring.swap(itr, ring.begin());
+	typename TypeParam::iterator rem(ring.begin());
+	loop_up(0, 20) {
+		rem = ring.remove(rem);
+	}
+	TypeParam moved(std::move(ring));
+	EXPECT_EQ(moved.size(), 21);
+	EXPECT_EQ(Tracked::copies, 0);
+	//copying the ring itself still copies every payload
+	TypeParam copy(moved);
+	EXPECT_EQ(Tracked::copies, 21);
+}
+
+TYPED_TEST(PayloadTests, ReadsByReference) {
+	TypeParam ring;
+	loop_up(0, 10) {
+		ring.emplace(i % 3, "payload", i + 1);
+	}
+	Tracked::copies = 0;
+	Tracked::moves = 0;
+	std::size_t total = 0;
+	for(const Tracked& info : ring) {
+		total += info.text.size();
+	}
+	const TypeParam& view = ring;
+	total += view.get_info(2, 2).text.size();
+	total += view.find(1, 3).info().text.size();
+	EXPECT_EQ(total, 7 * (55 + 6 + 8));
+	EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+	//found elements stay writable through a mutable ring
+	ring.find(0).info().text = "edited";
+	EXPECT_EQ(view.get_info(0).text, "edited");
+	EXPECT_EQ(&view.find(0, 2).key(), &view.find(0, 2).key());
+	EXPECT_FALSE(view.find(1, 5).valid());
+}
+
+TEST(PayloadTests, EmplaceInPlace) {
+	//linked nodes construct the payload where it stays
+	Tracked::copies = 0;
+	Tracked::moves = 0;
+	bi_ring<int, Tracked> ring;
+	bi_ring<int, Tracked>::iterator itr = ring.emplace(1, "ab", 3);
+	ring.emplace_after(itr, 2, "c");
+	ring.emplace_before(itr, 0, "d");
+	EXPECT_EQ(Tracked::copies + Tracked::moves, 0);
+	EXPECT_EQ(ring.get_info(1).text, "ababab");
+	EXPECT_EQ(std::prev(ring.end()).info().text, "d");
+}
+
+TEST_F(BiRingTests, NodeReuse) {
+	//removed node storage is handed out again
+	bi_ring<int, int>::iterator itr(*t1, 4);
+	int* released = &itr.key();
+	t1 -> remove(itr);
+	itr = t1 -> push(40, 50);
+	EXPECT_EQ(&itr.key(), released);
+	//ring spanning several pool blocks stays intact
+	loop_up(0, 10000) {
+		t0 -> push(i, i+1);
+	}
+	EXPECT_EQ(t0 -> size(), 10000);
+	EXPECT_EQ(t0 -> get_info(9999), 10000);
+}
+
+TEST_F(BiRingTests, CloneReusesNodes) {
+	//assigning over a ring overwrites its nodes in place
+	bi_ring<int, int> target(*this -> t2);
+	target.enable_index();
+	target.enable_positions();
+	const int* first_info = &target.begin().info();
+	target = *this -> t1;
+	EXPECT_EQ(target, *this -> t1);
+	EXPECT_EQ(&target.begin().info(), first_info);
+	EXPECT_EQ(target.count(2), 1);
+	EXPECT_EQ(target.at(9).key(), 9);
+	//growing and shrinking keep the modes in sync
+	target = *this -> t2;
+	EXPECT_EQ(target, *this -> t2);
+	EXPECT_EQ(target.get_info(2, 2), 5);
+	EXPECT_EQ(target.position_of(target.find(2, 2)), 10);
+	target = *this -> t1 + *this -> t1;
+	EXPECT_EQ(target.size(), 20);
+	target = *this -> t1;
+	EXPECT_EQ(target, *this -> t1);
+	EXPECT_EQ(target.count(0), 1);
+	EXPECT_THROW(target.at(10), std::out_of_range);
+	//empty source empties the ring
+	target = *this -> t0;
+	EXPECT_TRUE(target.empty());
+	target = *this -> t1;
+	EXPECT_EQ(target, *this -> t1);
+}
+
+TEST_F(BiRingTests, MemoryResource) {
+	//whole ring lives in a buffer with no fallback to the heap
+	alignas(64) static unsigned char buffer[1 << 16];
+	std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer),
+						  std::pmr::null_memory_resource());
+	pmr::bi_ring<int, int> ring(&arena);
+	loop_up(0, 100) {
+		ring.push(i, i+1);
+	}
+	EXPECT_EQ(ring.get_allocator().resource(), &arena);
+	EXPECT_EQ(ring.get_info(99), 100);
+	//copies do not inherit the resource
+	pmr::bi_ring<int, int> copy(ring);
+	EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+	EXPECT_EQ(copy, ring);
+	//moving between resources keeps each ring's own allocator
+	copy = std::move(ring);
+	EXPECT_EQ(copy.get_allocator().resource(), std::pmr::get_default_resource());
+	EXPECT_EQ(copy.get_info(99), 100);
+	pmr::bi_ring<int, int> moved(std::move(copy));
+	EXPECT_EQ(moved.size(), 100);
+	EXPECT_TRUE(copy.empty());
+}
+
+//payload whose copies start failing once armed runs out
+struct Brittle {
+	static int armed;
+	int value;
+	Brittle(int val) : value(val) {}
+	Brittle(const Brittle& src) : value(src.value) {
+		if(armed >= 0 && armed-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+	}
+	Brittle& operator=(const Brittle& src) {
+		if(armed >= 0 && armed-- == 0) {
+			throw std::runtime_error("copy failed");
+		}
+		value = src.value;
+		return *this;
+	}
+	bool operator==(const Brittle& cmp) const { return value == cmp.value; }
+	bool operator!=(const Brittle& cmp) const { return value != cmp.value; }
+};
+int Brittle::armed = -1;
+
+TEST_F(BiRingTests, IndexAfterFailedAssignment) {
+	//keys overwritten before a copy threw are found under their new value
+	bi_ring<int, Brittle> target{{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+	bi_ring<int, Brittle> source{{10, 10}, {11, 11}, {12, 12}, {13, 13}, {14, 14}};
+	target.enable_index();
+	Brittle::armed = 2;
+	EXPECT_THROW(target = source, std::runtime_error);
+	Brittle::armed = -1;
+	for(bi_ring<int, Brittle>::const_iterator itr = target.begin(); itr != target.end(); itr++) {
+		EXPECT_EQ(target.find(itr.key()), itr);
+	}
+	EXPECT_EQ(target.count(12), 1);
+	EXPECT_EQ(target.count(2), 0);
+}
+
+TEST_F(BiRingTests, KeyIndex) {
+	//replay the same edits on a plain and an indexed ring, keys repeat often
+	bi_ring<int, int> plain;
+	bi_ring<int, int> indexed;
+	indexed.enable_index();
+	bi_ring<int, int>::iterator itr_p;
+	bi_ring<int, int>::iterator itr_i;
+	unsigned int seed = 3;
+	loop_up(0, 3000) {
+		seed = seed * 1103515245 + 12345;
+		unsigned int op = (seed >> 16) % 9;
+		int key = (seed >> 8) % 13;
+		if(plain.empty() || op == 0) {
+			itr_p = plain.push(key, i);
+			itr_i = indexed.push(key, i);
+		}
+		else if(op == 1) {
+			itr_p = plain.insert_after(key, i, itr_p);
+			itr_i = indexed.insert_after(key, i, itr_i);
+		}
+		else if(op == 2) {
+			itr_p = plain.insert_before(key, i, itr_p);
+			itr_i = indexed.insert_before(key, i, itr_i);
+		}
+		else if(op == 3) {
+			itr_p = plain.remove(itr_p);
+			itr_i = indexed.remove(itr_i);
+		}
+		else if(op == 4) {
+			plain.replace(key, i, itr_p);
+			indexed.replace(key, i, itr_i);
+		}
+		else if(op == 5) {
+			plain.swap(itr_p, plain.begin());
+			indexed.swap(itr_i, indexed.begin());
+		}
+		else if(op == 6) {
+			plain.rotate_to(itr_p);
+			indexed.rotate_to(itr_i);
+		}
+		else if(op == 7) {
+			plain.swap_nodes(itr_p, std::prev(plain.end()));
+			indexed.swap_nodes(itr_i, std::prev(indexed.end()));
+		}
+		else {
+			itr_p--;
+			itr_i--;
+		}
+		ASSERT_EQ(plain, indexed);
+		for(int n = 1; n <= 3; n++) {
+			bi_ring<int, int>::const_iterator find_p(plain, key, n);
+			bi_ring<int, int>::const_iterator find_i(indexed, key, n);
+			ASSERT_EQ(find_p.valid(), find_i.valid());
+			if(find_p.valid()) {
+				ASSERT_EQ(find_p.info(), find_i.info());
+			}
+		}
+	}
+	//copies keep the mode, dropping the index falls back to scanning
+	bi_ring<int, int> copy(indexed);
+	EXPECT_TRUE(copy.indexed());
+	indexed.disable_index();
+	EXPECT_FALSE(indexed.indexed());
+	EXPECT_EQ(indexed.get_info(copy.begin().key()), copy.get_info(copy.begin().key()));
+	EXPECT_THROW(copy.get_info(-1), std::invalid_argument);
+	copy.purge();
+	EXPECT_THROW(copy.get_info(0), std::invalid_argument);
+}
+
+//keys in ring order, separated by spaces
+template <typename Ring>
+std::string keys_of(const Ring& ring) {
+	std::stringstream str;
+	for(auto itr = ring.begin(); itr != ring.end(); ++itr) {
+		str << itr.key() << ' ';
+	}
+	return str.str();
+}
+
+TEST_F(BiRingTests, SwapNodes) {
+	//every pair, neighbours and the first element included
+	loop_up(0, 6) {
+		for(int j = 0; j < 6; j++) {
+			bi_ring<int, int> moved;
+			bi_ring<int, int> copied;
+			for(int k = 0; k < 6; k++) {
+				moved.push(k % 4, k);
+				copied.push(k % 4, k);
+			}
+			moved.enable_index();
+			moved.enable_positions();
+			bi_ring<int, int>::iterator what(moved.at(i));
+			bi_ring<int, int>::iterator dest(moved.at(j));
+			ASSERT_TRUE(moved.swap_nodes(what, dest));
+			copied.swap(copied.at(i), copied.at(j));
+			ASSERT_EQ(moved, copied);
+			//iterators keep their payloads, indexes follow the new order
+			EXPECT_EQ(what.info(), i);
+			EXPECT_EQ(dest.info(), j);
+			EXPECT_EQ(moved.position_of(what), j);
+			EXPECT_EQ(moved.position_of(dest), i);
+			for(int k = 0; k < 6; k++) {
+				ASSERT_EQ(moved.at(k).info(), copied.at(k).info());
+			}
+			ASSERT_EQ(moved.get_info(1, 2), copied.get_info(1, 2));
+			ASSERT_EQ(moved.get_info(0, 2), copied.get_info(0, 2));
+		}
+	}
+	//equal keys trade places in the index too
+	bi_ring<int, int> same{{1, 0}, {5, 10}, {2, 0}, {5, 20}, {3, 0}, {5, 30}};
+	same.enable_index();
+	EXPECT_TRUE(same.swap_nodes(same.find(5, 2), same.find(5, 1)));
+	EXPECT_EQ(same.get_info(5, 1), 20);
+	EXPECT_EQ(same.get_info(5, 2), 10);
+	EXPECT_EQ(same.get_info(5, 3), 30);
+	//two elements trade places by moving the start
+	bi_ring<int, int> pair(0, 0);
+	pair.push(1, 1);
+	EXPECT_TRUE(pair.swap_nodes(pair.begin(), std::prev(pair.end())));
+	EXPECT_EQ(keys_of(pair), "1 0 ");
+	EXPECT_FALSE(pair.swap_nodes(pair.begin(), bi_ring<int, int>::iterator()));
+}
+
+TEST_F(BiRingTests, Splice) {
+	bi_ring<int, int> first;
+	bi_ring<int, int> second;
+	loop_up(0, 5) {
+		first.push(i, i);
+		second.push(i+10, i+10);
+	}
+	first.enable_index();
+	first.enable_positions();
+	//whole ring goes before the element with key 2
+	bi_ring<int, int>::iterator pos = first.find(2);
+	first.splice(pos, std::move(second));
+	EXPECT_TRUE(second.empty());
+	EXPECT_EQ(keys_of(first), "0 1 10 11 12 13 14 2 3 4 ");
+	EXPECT_EQ(first.get_info(13), 13);
+	EXPECT_EQ(first.position_of(first.find(3)), 8);
+	//range of three goes back, into an empty ring
+	second.splice(second.begin(), first, first.find(11), first.find(14));
+	EXPECT_EQ(first.size(), 7);
+	EXPECT_EQ(second.size(), 3);
+	EXPECT_EQ(second.begin().key(), 11);
+	EXPECT_EQ(std::prev(second.end()).key(), 13);
+	EXPECT_THROW(first.get_info(12), std::invalid_argument);
+	EXPECT_EQ(first.at(3).key(), 14);
+	//moving a range over the first element, within the same ring
+	first.splice(first.find(3), first, first.find(4), first.find(1));
+	EXPECT_EQ(keys_of(first), "1 10 14 2 4 0 3 ");
+	EXPECT_EQ(first.at(0).key(), 1);
+	EXPECT_EQ(first.position_of(first.find(0)), 5);
+	EXPECT_THROW({
+		first.splice(first.find(2), first, first.find(14), first.find(0));
+	}, std::invalid_argument);
+	//an empty ring with both indexes files everything it receives
+	bi_ring<int, int> empty;
+	empty.enable_index();
+	empty.enable_positions();
+	empty.splice(empty.begin(), first, first.find(10), first.find(4));
+	EXPECT_EQ(keys_of(empty), "10 14 2 ");
+	EXPECT_EQ(empty.get_info(14), 14);
+	EXPECT_EQ(empty.position_of(empty.find(2)), 2);
+	EXPECT_EQ(empty.at(1).key(), 14);
+	first.splice(first.find(4), std::move(empty));
+	EXPECT_EQ(keys_of(first), "1 10 14 2 4 0 3 ");
+	//a chain of a key already present is filed in front of it, in ring order
+	bi_ring<int, int> repeated;
+	repeated.push(0, 0);
+	repeated.push(7, 100);
+	repeated.enable_index();
+	repeated.splice(repeated.find(7), bi_ring<int, int>{{7, 1}, {7, 2}});
+	EXPECT_EQ(repeated.get_info(7, 1), 1);
+	EXPECT_EQ(repeated.get_info(7, 2), 2);
+	EXPECT_EQ(repeated.get_info(7, 3), 100);
+	//spliced nodes outlive the ring they were allocated by
+	{
+		bi_ring<int, int> scratch;
+		loop_up(0, 100) {
+			scratch.push(i+100, i);
+		}
+		first.splice(first.begin(), std::move(scratch));
+	}
+	EXPECT_EQ(first.size(), 107);
+	EXPECT_EQ(first.get_info(199), 99);
+	first.purge();
+	EXPECT_TRUE(first.empty());
+}
+
+TYPED_TEST(RingTests, IteratorLaps) {
+	//iterators follow their elements through swap() and moves
+	TypeParam first;
+	TypeParam secnd;
+	loop_up(0, 6) {
+		first.push(i, i);
+	}
+	secnd.push(9, 9);
+	typename TypeParam::iterator itr = first.begin();
+	itr++;
+	first.swap(secnd);
+	EXPECT_EQ(std::distance(typename TypeParam::const_iterator(itr), secnd.end()), 5);
+	TypeParam moved(std::move(secnd));
+	EXPECT_EQ(std::distance(typename TypeParam::const_iterator(itr), moved.end()), 5);
+	TypeParam assigned;
+	assigned = std::move(moved);
+	EXPECT_EQ(itr.key(), 1);
+	//and through edits at the back
+	assigned.push(6, 6);
+	EXPECT_EQ(std::distance(typename TypeParam::const_iterator(itr), assigned.end()), 6);
+}
+
+TEST_F(BiRingTests, IteratorLapsNewFirst) {
+	//older iterators count laps against whichever element is first now
+	bi_ring<int, int> ring{{0, 0}, {1, 1}, {2, 2}, {3, 3}};
+	bi_ring<int, int>::iterator last = ring.find(3);
+	bi_ring<int, int>::iterator second = ring.find(1);
+	ring.rotate_to(ring.find(2));
+	EXPECT_EQ(std::distance(bi_ring<int, int>::const_iterator(last), ring.end()), 3);
+	ring.remove(ring.begin());
+	EXPECT_EQ(std::distance(bi_ring<int, int>::const_iterator(second), ring.end()), 1);
+	EXPECT_EQ(std::distance(bi_ring<int, int>::const_iterator(last), ring.end()), 3);
+	//removing the first element hands the returned iterator the new first
+	bi_ring<int, int>::iterator itr = ring.remove(ring.begin());
+	EXPECT_EQ(itr, ring.begin());
+	EXPECT_EQ(std::distance(bi_ring<int, int>::const_iterator(itr), ring.end()), 2);
+}
+
+TEST_F(BiRingTests, SpliceAcrossResources) {
+	//unequal allocators move payloads instead of relinking nodes
+	std::pmr::monotonic_buffer_resource arena_a;
+	std::pmr::monotonic_buffer_resource arena_b;
+	pmr::bi_ring<int, int> first(&arena_a);
+	pmr::bi_ring<int, int> second(&arena_b);
+	loop_up(0, 4) {
+		first.push(i, i);
+		second.push(i+10, i);
+	}
+	second.enable_index();
+	first.splice(first.begin(), second, second.find(11), second.find(13));
+	EXPECT_EQ(first.size(), 6);
+	EXPECT_EQ(second.size(), 2);
+	EXPECT_EQ(second.get_info(13), 3);
+	first.splice(first.begin(), std::move(second));
+	EXPECT_TRUE(second.empty());
+	EXPECT_EQ(keys_of(first), "0 1 2 3 11 12 10 13 ");
+	EXPECT_EQ(first.get_allocator().resource(), &arena_a);
+}
+
+TEST_F(BiRingTests, Positions) {
+	//replay the same edits on a plain and a positioned ring
+	bi_ring<int, int> plain;
+	bi_ring<int, int> positioned;
+	positioned.enable_positions();
+	bi_ring<int, int>::iterator itr_p;
+	bi_ring<int, int>::iterator itr_o;
+	unsigned int seed = 11;
+	loop_up(0, 2000) {
+		seed = seed * 1103515245 + 12345;
+		unsigned int op = (seed >> 16) % 5;
+		if(plain.empty() || op == 0) {
+			itr_p = plain.push(i, i);
+			itr_o = positioned.push(i, i);
+		}
+		else if(op == 1) {
+			itr_p = plain.insert_after(i, i, itr_p);
+			itr_o = positioned.insert_after(i, i, itr_o);
+		}
+		else if(op == 2) {
+			itr_p = plain.insert_before(i, i, itr_p);
+			itr_o = positioned.insert_before(i, i, itr_o);
+		}
+		else if(op == 3) {
+			itr_p = plain.remove(itr_p);
+			itr_o = positioned.remove(itr_o);
+		}
+		if(plain.empty()) {
+			continue;
+		}
+		int stride = static_cast<int>(seed >> 20) - 2048;
+		ASSERT_EQ(plain.position_of(itr_p), positioned.position_of(itr_o));
+		ASSERT_EQ(plain.advance(itr_p, stride).key(), positioned.advance(itr_o, stride).key());
+		unsigned int pos = (seed >> 4) % plain.size();
+		ASSERT_EQ(plain.at(pos).key(), positioned.at(pos).key());
+		ASSERT_EQ(positioned.position_of(positioned.at(pos)), pos);
+	}
+	ASSERT_EQ(plain, positioned);
+	//strides wrap around the ring both ways
+	bi_ring<int, int>::const_iterator first(*this -> t1);
+	EXPECT_EQ(this -> t1 -> advance(first, 23).key(), 3);
+	EXPECT_EQ(this -> t1 -> advance(first, -1).key(), 9);
+	this -> t1 -> enable_positions();
+	EXPECT_EQ(this -> t1 -> advance(first, -21).key(), 9);
+	EXPECT_EQ(this -> t1 -> position_of(std::prev(this -> t1 -> end())), 9);
+	EXPECT_THROW({
+		this -> t1 -> at(10);
+	}, std::out_of_range);
+	EXPECT_THROW({
+		this -> t1 -> position_of(bi_ring<int, int>::const_iterator());
+	}, std::domain_error);
+	//copies keep the mode, purge empties the index
+	bi_ring<int, int> copy(*this -> t1);
+	EXPECT_TRUE(copy.positioned());
+	bi_ring<int, int>::const_iterator stale = copy.begin();
+	copy.purge();
+	EXPECT_THROW(copy.advance(stale, 3), std::domain_error);
+	EXPECT_THROW(copy.position_of(stale), std::domain_error);
+	EXPECT_THROW(copy.advance(bi_ring<int, int>::const_iterator(), 1), std::domain_error);
+	copy.push(5, 5);
+	EXPECT_EQ(copy.at(0).key(), 5);
+}
+
+TEST_F(BiRingTests, ParallelBulk) {
+	thread_pool workers(4);
+	bi_ring<int, int> ring;
+	loop_up(0, 100000) {
+		ring.push(i, i % 7);
+	}
+	bi_ring<int, int> copy(ring);
+	auto odd = [](const int& key, const int&) { return key % 2 == 1; };
+	EXPECT_EQ(ring.count_if(workers, odd), 50000u);
+	EXPECT_EQ(ring.count_if(workers, odd), ring.count_if(odd));
+	EXPECT_TRUE(ring.equal(workers, copy));
+	//every element is visited exactly once
+	std::atomic<long long> keys(0);
+	ring.for_each(workers, [&](const int& key, int&) { keys += key; });
+	EXPECT_EQ(keys, 99999LL * 100000 / 2);
+	ring.transform_info(workers, [](const int& key, const int& info) { return key + info; });
+	copy.transform_info([](const int& key, const int& info) { return key + info; });
+	EXPECT_TRUE(ring.equal(workers, copy));
+	EXPECT_TRUE(ring == copy);
+	//checkpoints follow changes to the ring
+	copy.remove(copy.find(50000));
+	copy.push(50000, 50000 + 50000 % 7);
+	EXPECT_FALSE(ring.equal(workers, copy));
+	ring.remove(ring.find(50000));
+	ring.push(50000, 50000 + 50000 % 7);
+	EXPECT_TRUE(ring.equal(workers, copy));
+	ring.enable_positions();
+	ring.swap_nodes(ring.find(10), ring.find(90000));
+	EXPECT_FALSE(ring.equal(workers, copy));
+	EXPECT_EQ(ring.count_if(workers, odd), 50000u);
+	EXPECT_TRUE(ring.clear_info(workers, 3));
+	EXPECT_EQ(ring.count_if(workers, [](const int&, const int& info) { return info == 3; }), 100000u);
+	EXPECT_FALSE(this -> t0 -> clear_info(workers, 3));
+	//const passes with different segment counts run at once on one ring
+	bi_ring<int, int> same(ring);
+	std::vector<std::thread> readers;
+	std::atomic<int> mismatches(0);
+	for(unsigned int pool = 2; pool < 5; pool++) {
+		readers.emplace_back([&, pool] {
+			thread_pool own(pool);
+			loop_up(0, 20) {
+				if(ring.count_if(own, odd) != 50000u || !ring.equal(own, same)) {
+					mismatches++;
+				}
+			}
+		});
+	}
+	for(std::thread& reader : readers) {
+		reader.join();
+	}
+	EXPECT_EQ(mismatches, 0);
+}
+
+TEST_F(BiRingTests, SortMerge) {
+	bi_ring<int, int> ring;
+	unsigned int seed = 5;
+	loop_up(0, 1000) {
+		seed = seed * 1103515245 + 12345;
+		ring.push((seed >> 16) % 50, i);
+	}
+	ring.enable_index();
+	ring.enable_positions();
+	const int* node = &ring.find(7).info();
+	ring.sort();
+	//equal keys keep their order, nodes stay where they were allocated
+	bool ordered = true;
+	for(bi_ring<int, int>::const_iterator itr = ring.begin(); std::next(itr) != ring.end(); ++itr) {
+		bi_ring<int, int>::const_iterator next = std::next(itr);
+		ordered = ordered && (itr.key() < next.key() || (itr.key() == next.key() && *itr < *next));
+	}
+	EXPECT_TRUE(ordered);
+	EXPECT_EQ(ring.size(), 1000);
+	EXPECT_EQ(&ring.find(7).info(), node);
+	EXPECT_EQ(std::prev(ring.end()).key(), 49);
+	EXPECT_EQ(ring.get_info(0, 2), ring.find(0, 2).info());
+	EXPECT_EQ(ring.at(ring.count(0)).key(), 1);
+	ring.sort(std::greater<int>());
+	EXPECT_EQ(ring.begin().key(), 49);
+	EXPECT_EQ(ring.position_of(ring.find(49, 2)), 1);
+	//merging keeps ties from this ring first
+	bi_ring<int, int> first;
+	bi_ring<int, int> second;
+	loop_up(0, 5) {
+		first.push(2 * i, 0);
+		second.push(i + 3, 1);
+	}
+	first.merge(std::move(second));
+	EXPECT_TRUE(second.empty());
+	EXPECT_EQ(keys_of(first), "0 2 3 4 4 5 6 6 7 8 ");
+	EXPECT_EQ(first.find(4).info(), 0);
+	EXPECT_EQ(first.find(6, 2).info(), 1);
+	second.merge(std::move(first));
+	EXPECT_EQ(second.size(), 10);
+	first.push(8, 2);
+	first.push(9, 2);
+	second.merge(std::move(first));
+	EXPECT_EQ(keys_of(second), "0 2 3 4 4 5 6 6 7 8 8 9 ");
+	EXPECT_EQ(std::prev(second.end(), 2).info(), 2);
+	//unequal allocators move the payloads over first
+	std::pmr::monotonic_buffer_resource arena;
+	pmr::bi_ring<int, int> local(&arena);
+	local.push(1, 1);
+	local.push(9, 9);
+	pmr::bi_ring<int, int> other;
+	other.push(5, 5);
+	local.merge(std::move(other));
+	EXPECT_EQ(keys_of(local), "1 5 9 ");
+	//a throwing comparison leaves every element in the ring
+	EXPECT_THROW(ring.sort([](const int& a, const int& b) {
+		if(a == 25 || b == 25) {
+			throw std::runtime_error("compare");
+		}
+		return a < b;
+	}), std::runtime_error);
+	EXPECT_EQ(ring.size(), 1000);
+	EXPECT_EQ(std::distance(ring.begin(), ring.end()), 1000);
+	EXPECT_EQ(ring.count(25), ring.count_if([](const int& key, const int&) { return key == 25; }));
+}
+
+TEST_F(BiRingTests, SplitRotateReverse) {
+	bi_ring<int, int> ring;
+	loop_up(0, 8) {
+		ring.push(i % 4, i);
+	}
+	ring.enable_index();
+	ring.enable_positions();
+	const int* node = &ring.find(2, 2).info();
+	//the tail from the second 2 onwards keeps its nodes
+	bi_ring<int, int> tail = ring.split(ring.find(2, 2));
+	EXPECT_EQ(keys_of(ring), "0 1 2 3 0 1 ");
+	EXPECT_EQ(keys_of(tail), "2 3 ");
+	EXPECT_EQ(&tail.begin().info(), node);
+	EXPECT_EQ(ring.count(2), 1);
+	EXPECT_THROW(ring.get_info(2, 2), std::invalid_argument);
+	EXPECT_EQ(ring.at(5).key(), 1);
+	EXPECT_EQ(std::prev(ring.end()).info(), 5);
+	//rotation moves the start only
+	ring.rotate_to(ring.find(3));
+	EXPECT_EQ(keys_of(ring), "3 0 1 0 1 2 ");
+	EXPECT_EQ(ring.at(0).key(), 3);
+	EXPECT_EQ(ring.position_of(ring.find(2)), 5);
+	EXPECT_EQ(ring.find(0).info(), 4);
+	EXPECT_EQ(ring.get_info(1, 2), 1);
+	ring.reverse();
+	EXPECT_EQ(keys_of(ring), "3 2 1 0 1 0 ");
+	EXPECT_EQ(ring.get_info(1, 2), 5);
+	EXPECT_EQ(ring.position_of(ring.find(2)), 1);
+	EXPECT_EQ(std::prev(ring.end()).info(), 4);
+	//splitting at the start hands over the whole ring
+	bi_ring<int, int> all = ring.split(ring.begin());
+	EXPECT_TRUE(ring.empty());
+	EXPECT_FALSE(ring.find(3).valid());
+	EXPECT_EQ(all.size(), 6);
+	EXPECT_THROW(ring.rotate_to(ring.find(3)), std::domain_error);
+	//split nodes outlive the ring they came from
+	{
+		bi_ring<int, int> scratch;
+		loop_up(0, 50) {
+			scratch.push(i, i);
+		}
+		tail = scratch.split(scratch.find(40));
+	}
+	EXPECT_EQ(tail.size(), 10);
+	EXPECT_EQ(tail.get_info(49), 49);
+	tail.purge();
+}
+
+//counts the blocks handed out by the default resource and not yet returned
+class counting_resource : public std::pmr::memory_resource {
+public:
+	int allocations = 0;
+	int live = 0;
+private:
+	void* do_allocate(std::size_t bytes, std::size_t align) override {
+		allocations++;
+		live++;
+		return std::pmr::get_default_resource() -> allocate(bytes, align);
+	}
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t align) override {
+		live--;
+		std::pmr::get_default_resource() -> deallocate(ptr, bytes, align);
+	}
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+		return this == &other;
+	}
+};
+
+TEST_F(BiRingTests, SplitRetention) {
+	//split allocates nothing and takes only the blocks its nodes live in
+	counting_resource counter;
+	pmr::bi_ring<int, int> tail(&counter);
+	{
+		pmr::bi_ring<int, int> ring(&counter);
+		loop_up(0, 5000) {
+			ring.push(i, i);
+		}
+		int before = counter.allocations;
+		tail = ring.split(ring.find(4990));
+		EXPECT_EQ(counter.allocations, before);
+	}
+	EXPECT_EQ(counter.live, 1);
+	EXPECT_EQ(tail.size(), 10);
+	EXPECT_EQ(tail.get_info(4999), 4999);
+	//a whole ring spliced in leaves its source holding nothing
+	pmr::bi_ring<int, int> other(&counter);
+	other.push(1, 1);
+	tail.splice(tail.begin(), std::move(other));
+	EXPECT_EQ(counter.live, 2);
+	tail.purge();
+}
+
+TEST_F(BiRingTests, BulkRemoval) {
+	bi_ring<int, int> ring;
+	loop_up(0, 20) {
+		ring.push(i % 5, i);
+	}
+	ring.enable_positions();
+	//the first element goes too, the start moves on to the next survivor
+	EXPECT_EQ(ring.remove_if([](const int&, const int& info) { return info % 3 == 0; }), 7u);
+	EXPECT_EQ(ring.size(), 13);
+	EXPECT_EQ(ring.begin().info(), 1);
+	EXPECT_EQ(ring.at(12).info(), 19);
+	EXPECT_EQ(ring.count_if([](const int&, const int& info) { return info % 3 == 0; }), 0u);
+	EXPECT_EQ(ring.remove_key(1), 3u);
+	EXPECT_EQ(ring.remove_key(7), 0u);
+	ring.enable_index();
+	EXPECT_EQ(ring.remove_key(2), 3u);
+	EXPECT_EQ(keys_of(ring), "4 0 3 0 3 4 4 ");
+	EXPECT_THROW(ring.get_info(2), std::invalid_argument);
+	EXPECT_EQ(ring.get_info(0, 2), 10);
+	//a range over the start of the ring
+	bi_ring<int, int>::iterator next = ring.erase(ring.find(4, 2), ring.find(0));
+	EXPECT_EQ(next.info(), 5);
+	EXPECT_EQ(keys_of(ring), "0 3 0 3 ");
+	EXPECT_EQ(ring.position_of(ring.find(3)), 1);
+	EXPECT_EQ(ring.get_info(0, 2), 10);
+	EXPECT_FALSE(ring.find(4).valid());
+	EXPECT_EQ(ring.erase(next, next).key(), 0);
+	EXPECT_THROW(ring.erase(bi_ring<int, int>::iterator(), next), std::domain_error);
+	EXPECT_FALSE(ring.erase(ring.begin(), ring.end()).valid());
+	EXPECT_TRUE(ring.empty());
+	EXPECT_EQ(ring.remove_if([](const int&, const int&) { return true; }), 0u);
+	ring.push(1, 1);
+	EXPECT_EQ(ring.remove_key(1), 1u);
+	EXPECT_TRUE(ring.empty());
+}
+
+TEST_F(BiRingTests, RangeInsertion) {
+	bi_ring<int, std::string> ring{{1, "a"}, {2, "b"}, {3, "c"}};
+	EXPECT_EQ(keys_of(ring), "1 2 3 ");
+	EXPECT_EQ(std::prev(ring.end()).info(), "c");
+	std::vector<std::pair<int, std::string>> items{{4, "d"}, {5, "e"}};
+	ring.enable_index();
+	ring.enable_positions();
+	ring.append(items.begin(), items.end());
+	EXPECT_EQ(keys_of(ring), "1 2 3 4 5 ");
+	EXPECT_EQ(ring.get_info(5), "e");
+	bi_ring<int, std::string>::iterator last = ring.insert_after(ring.find(1), items.begin(), items.end());
+	EXPECT_EQ(keys_of(ring), "1 4 5 2 3 4 5 ");
+	EXPECT_EQ(last.key(), 5);
+	EXPECT_EQ(ring.position_of(ring.find(5, 2)), 6);
+	EXPECT_EQ(ring.find(4, 1).info(), "d");
+	EXPECT_EQ(ring.insert_after(last, items.end(), items.end()), last);
+	EXPECT_THROW(ring.insert_after(bi_ring<int, std::string>::iterator(), items.begin(), items.end()), std::domain_error);
+	//repeated keys are filed in ring order, ahead of later occurrences
+	bi_ring<int, int> repeated{{1, 0}, {5, 100}};
+	repeated.enable_index();
+	std::vector<std::pair<int, int>> chain{{5, 1}, {5, 2}};
+	std::vector<std::pair<int, int>> tail{{5, 200}, {1, 1}, {5, 300}};
+	repeated.insert_after(repeated.begin(), chain.begin(), chain.end());
+	repeated.append(tail.begin(), tail.end());
+	EXPECT_EQ(keys_of(repeated), "1 5 5 5 5 1 5 ");
+	loop_up(0, 5) {
+		EXPECT_EQ(repeated.get_info(5, i+1), std::vector<int>({1, 2, 100, 200, 300})[i]);
+	}
+	EXPECT_EQ(repeated.get_info(1, 2), 1);
+	//payloads moved in through move iterators
+	bi_ring<int, std::string> moved(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()));
+	EXPECT_EQ(moved.get_info(4), "d");
+	EXPECT_TRUE(items[0].second.empty());
+	std::map<int, std::string> sorted{{9, "z"}, {8, "y"}};
+	bi_ring<int, std::string> from_map(sorted.begin(), sorted.end());
+	EXPECT_EQ(keys_of(from_map), "8 9 ");
+	bi_ring<int, int> counted(3, 4);
+	EXPECT_EQ(counted.size(), 1);
+	EXPECT_EQ(counted.get_info(3), 4);
+}
+
+TEST_F(BiRingTests, TextOutput) {
+	//buffered formatting prints what plain stream insertion would
+	bi_ring<double, std::string> ring{{0.1, "a"}, {1234567.0, "bc"}, {-2.5e-9, ""}, {1e100, "d"}};
+	std::ostringstream plain;
+	for(auto itr = ring.begin(); itr != ring.end(); ++itr) {
+		plain << '[' << itr.key() << "] " << itr.info() << "\n";
+	}
+	std::ostringstream fast;
+	fast << ring;
+	EXPECT_EQ(fast.str(), plain.str());
+	EXPECT_EQ(fast.str(), "[0.1] a\n[1.23457e+06] bc\n[-2.5e-09] \n[1e+100] d\n");
+	//streams set up by the caller keep their formatting
+	bi_ring<int, unsigned char> bytes{{255, 'x'}, {-16, 'y'}};
+	std::ostringstream hex;
+	hex << std::hex << std::showbase << bytes;
+	EXPECT_EQ(hex.str(), "[0xff] x\n[0xfffffff0] y\n");
+	std::ostringstream precise;
+	precise.precision(10);
+	precise << ring;
+	EXPECT_EQ(precise.str().substr(0, 18), "[0.1] a\n[1234567] ");
+	//output larger than the buffer arrives whole and in order
+	bi_ring<int, int> large;
+	loop_up(0, 5000) {
+		large.push(i, -i);
+	}
+	std::ostringstream big;
+	big << large;
+	EXPECT_EQ(big.str().size(), 4u * 5000 + 2 * (10 + 90 * 2 + 900 * 3 + 4000 * 4) + 4999);
+	EXPECT_EQ(big.str().substr(big.str().size() - 13), "[4999] -4999\n");
+}
+
+//saved through the string encoding of its text
+template <>
+struct ring_codec<Tracked> {
+	static constexpr bool raw = false;
+	static constexpr std::uint32_t tag = 256;
+	static constexpr std::uint32_t size = 0;
+	static void write(std::ostream& str, const Tracked& value) {
+		ring_codec<std::string>::write(str, value.text);
+	}
+	static Tracked read(std::istream& str) {
+		return Tracked(ring_codec<std::string>::read(str), 1);
+	}
+};
+
+//two records of one size, told apart by their tags alone
+struct Point {
+	int x;
+	int y;
+};
+struct Span {
+	int first;
+	int last;
+};
+template <>
+struct ring_codec<Point> : raw_codec<Point, 300> {};
+template <>
+struct ring_codec<Span> : raw_codec<Span, 301> {};
+
+TEST_F(BiRingTests, SaveLoad) {
+	bi_ring<int, int> ring;
+	loop_up(0, 20000) {
+		ring.push(i % 97, -i);
+	}
+	std::stringstream data;
+	ring.save(data);
+	EXPECT_EQ(data.str().size(), sizeof(ring_header) + 20000 * 2 * sizeof(int));
+	bi_ring<int, int> loaded;
+	loaded.push(5, 5);
+	loaded.enable_index();
+	loaded.load(data);
+	EXPECT_TRUE(loaded == ring);
+	EXPECT_EQ(loaded.get_info(3, 2), -100);
+	//strings and custom encodings alike
+	bi_ring<std::string, Tracked> named{{"one", "a"}, {"", ""}, {"three", "ccc"}};
+	std::stringstream text;
+	named.save(text);
+	bi_ring<std::string, Tracked> back;
+	back.load(text);
+	EXPECT_TRUE(back == named);
+	//records keep the block copies, another record of their size is refused
+	bi_ring<int, Point> points{{1, {2, 3}}, {4, {5, 6}}};
+	std::stringstream packed;
+	points.save(packed);
+	EXPECT_EQ(packed.str().size(), sizeof(ring_header) + 2 * (sizeof(int) + sizeof(Point)));
+	bi_ring<int, Point> read_back;
+	read_back.load(packed);
+	EXPECT_EQ(read_back.get_info(4).y, 6);
+	packed.clear();
+	packed.seekg(0);
+	bi_ring<int, Span> spans;
+	EXPECT_THROW(spans.load(packed), std::invalid_argument);
+	//rejected data leaves the ring as it was
+	std::stringstream other;
+	named.save(other);
+	EXPECT_THROW(loaded.load(other), std::invalid_argument);
+	std::string cut = data.str().substr(0, data.str().size() - 3);
+	std::stringstream truncated(cut);
+	EXPECT_THROW(loaded.load(truncated), std::invalid_argument);
+	std::stringstream garbage("not a ring at all, just some text");
+	EXPECT_THROW(loaded.load(garbage), std::invalid_argument);
+	EXPECT_TRUE(loaded == ring);
+	std::stringstream empty;
+	this -> t0 -> save(empty);
+	loaded.load(empty);
+	EXPECT_TRUE(loaded.empty());
+}
+
+TYPED_TEST(BackendTests, MatchesLinkedRing) {
+	//replay the same pseudo-random edits on both backends
+	bi_ring<int, int> linked;
+	TypeParam other;
+	bi_ring<int, int>::iterator itr_l;
+	typename TypeParam::iterator itr_o;
+	unsigned int seed = 7;
+	loop_up(0, 5000) {
+		seed = seed * 1103515245 + 12345;
+		unsigned int op = (seed >> 16) % 8;
+		if(linked.empty() || op == 0) {
+			itr_l = linked.push(i, -i);
+			itr_o = other.push(i, -i);
+		}
+		else if(op == 1 || op > 5) {
+			itr_l = linked.insert_after(i, -i, itr_l);
+			itr_o = other.insert_after(i, -i, itr_o);
+		}
+		else if(op == 2) {
+			itr_l = linked.insert_before(i, -i, itr_l);
+			itr_o = other.insert_before(i, -i, itr_o);
+		}
+		else if(op == 3) {
+			itr_l = linked.remove(itr_l);
+			itr_o = other.remove(itr_o);
+		}
+		else if(op == 4) {
+			itr_l = linked.remove_after(itr_l);
+			itr_o = other.remove_after(itr_o);
+		}
+		else {
+			itr_l = linked.remove_before(itr_l);
+			itr_o = other.remove_before(itr_o);
+		}
+		ASSERT_EQ(linked.size(), other.size());
+		ASSERT_EQ(itr_l.valid(), itr_o.valid());
+		if(itr_l.valid()) {
+			ASSERT_EQ(itr_l.key(), itr_o.key());
+		}
+	}
+	std::stringstream str_l, str_o;
+	str_l << linked;
+	str_o << other;
+	EXPECT_EQ(str_l.str(), str_o.str());
+}
+
+TEST(BufferTests, PositionalAccess) {
+	//wrap the buffer around by removing at the front
+	bi_ring_buffer<int, int> ring;
+	loop_up(0, 8) {
+		ring.push(i, i+1);
+	}
+	bi_ring_buffer<int, int>::iterator itr(ring.begin());
+	loop_up(0, 5) {
+		itr = ring.remove(itr);
+	}
+	loop_up(8, 14) {
+		ring.push(i, i+1);
+	}
+	EXPECT_EQ(ring.size(), 9);
+	EXPECT_EQ(ring.capacity(), 16);
+	//positions count from the first element
+	loop_up(0, 9) {
+		EXPECT_EQ(ring.at(i).key(), i+5);
+		EXPECT_EQ(ring.at(i).position(), i);
+	}
+	EXPECT_THROW({
+		ring.at(9);
+	}, std::out_of_range);
+	//strided steps jump and wrap around
+	bi_ring_buffer<int, int>::const_iterator jump(ring);
+	jump.operator++(20);
+	EXPECT_EQ(jump.key(), 7);
+	jump.operator--(4);
+	EXPECT_EQ(jump.key(), 12);
+}
+
+TEST(BufferTests, FailedGrowth) {
+	//a copy throwing while the buffer grows leaves the ring as it was
+	bi_ring_buffer<int, Brittle> ring;
+	loop_up(0, 8) {
+		ring.push(i, Brittle(i));
+	}
+	EXPECT_EQ(ring.capacity(), 8);
+	Brittle::armed = 5;
+	EXPECT_THROW(ring.push(8, Brittle(8)), std::runtime_error);
+	Brittle::armed = -1;
+	EXPECT_EQ(ring.size(), 8);
+	EXPECT_EQ(ring.capacity(), 8);
+	loop_up(0, 8) {
+		EXPECT_EQ(ring.at(i).info().value, i);
+	}
+	ring.push(8, Brittle(8));
+	EXPECT_EQ(ring.capacity(), 16);
 }
 
-TEST_F(RingTests, Size) {
-	EXPECT_EQ(t0 -> size(), 0);
-	EXPECT_EQ(t1 -> size(), 10);
-	EXPECT_EQ(t2 -> size(), 11);
+template <typename Key>
+void check_key_scan() {
+	//matches land in every lane and in the scalar tail
+	Key keys[45];
+	loop_up(0, 45) {
+		keys[i] = static_cast<Key>(i % 3 == 0 || i == 44 ? 100 : i);
+	}
+	scan_isa best = key_scan_isa();
+	for(scan_isa isa : {scan_isa::scalar, scan_isa::sse4, scan_isa::avx2}) {
+		if(isa > best) {
+			break;
+		}
+		key_scan_isa() = isa;
+		EXPECT_EQ(key_count(keys, 45, Key(100)), 16);
+		EXPECT_EQ(key_count(keys, 45, Key(44)), 0);
+		loop_up(1, 16) {
+			unsigned int nth = i;
+			EXPECT_EQ(key_locate(keys, 45, Key(100), nth), 3 * (i-1));
+		}
+		unsigned int nth = 16;
+		EXPECT_EQ(key_locate(keys, 45, Key(100), nth), 44);
+		nth = 20;
+		EXPECT_EQ(key_locate(keys, 45, Key(100), nth), 45);
+		EXPECT_EQ(nth, 4);
+	}
+	key_scan_isa() = best;
 }
 
-TEST_F(RingTests, Print) {
+TEST(UnrolledTests, IteratorInvalidation) {
+	//push packs nodes of four, 0-3, 4-7 and 8-11
+	bi_ring_unrolled<int, int, 4> ring;
+	loop_up(0, 12) {
+		ring.push(i, i);
+	}
+	bi_ring_unrolled<int, int, 4>::iterator shifted = ring.find(2);
+	bi_ring_unrolled<int, int, 4>::iterator middle = ring.find(5);
+	bi_ring_unrolled<int, int, 4>::iterator last = ring.find(9);
+	const int* moved = &ring.find(3).info();
+	//splitting the first node leaves the other nodes alone
+	bi_ring_unrolled<int, int, 4>::iterator added = ring.insert_before(100, 100, ring.find(1));
+	EXPECT_EQ(added.key(), 100);
+	EXPECT_EQ(middle.key(), 5);
+	EXPECT_EQ(last.key(), 9);
+	EXPECT_NE(shifted.key(), 2);
+	EXPECT_NE(&ring.find(3).info(), moved);
+	//emptying the middle node refills it from the last one
+	ring.remove(ring.find(4));
+	ring.remove(ring.find(6));
+	bi_ring_unrolled<int, int, 4>::iterator next = ring.remove(ring.find(5));
+	EXPECT_EQ(next.key(), 7);
+	EXPECT_EQ(ring.find(0).key(), 0);
+	EXPECT_EQ(ring.find(100).key(), 100);
+	EXPECT_NE(last.key(), 9);
+	EXPECT_EQ(ring.size(), 10);
+}
+
+TEST(KeyScanTests, EveryInstructionSet) {
+	check_key_scan<int>();
+	check_key_scan<unsigned int>();
+	check_key_scan<std::uint64_t>();
+	check_key_scan<float>();
+	check_key_scan<double>();
+	check_key_scan<short>();
+}
+
+TEST(ConcurrentTests, SingleThread) {
+	concurrent_bi_ring<int, int> ring;
+	EXPECT_TRUE(ring.empty());
+	concurrent_bi_ring<int, int>::iterator first = ring.push(1, 10);
+	ring.push(3, 30);
+	concurrent_bi_ring<int, int>::iterator second = ring.insert_after(2, 20, first);
+	ring.insert_after(1, 11, ring.find(3));
+	EXPECT_EQ(ring.size(), 4u);
+	std::string keys;
+	ring.for_each([&](const int& key, int& info) {
+		keys += std::to_string(key) + " ";
+		info++;
+	});
+	EXPECT_EQ(keys, "1 2 3 1 ");
+	EXPECT_EQ(ring.get_info(1, 2), 12);
+	EXPECT_EQ(ring.count(1), 2u);
+	EXPECT_THROW(ring.get_info(4), std::invalid_argument);
+	EXPECT_TRUE(ring.update(second, [](int& info) { info = 0; }));
+	EXPECT_EQ(ring.get_info(2), 0);
+	//removed elements refuse further work
+	EXPECT_TRUE(ring.remove(second));
+	EXPECT_FALSE(ring.remove(second));
+	EXPECT_FALSE(ring.update(second, [](int& info) { info = 1; }));
+	EXPECT_FALSE(ring.insert_after(5, 5, second).valid());
+	EXPECT_EQ(second.key(), 2);
+	EXPECT_EQ(ring.size(), 3u);
+	EXPECT_FALSE(ring.find(2).valid());
+	EXPECT_THROW(ring.remove(concurrent_bi_ring<int, int>::iterator()), std::domain_error);
+	//the last iterator to a removed element frees it
+	second = concurrent_bi_ring<int, int>::iterator();
+	EXPECT_FALSE(second.valid());
+	EXPECT_TRUE(ring.remove(ring.find(1)));
+	EXPECT_TRUE(ring.remove(ring.find(3)));
+	EXPECT_TRUE(ring.remove(ring.find(1)));
+	EXPECT_TRUE(ring.empty());
+}
+
+TEST(ConcurrentTests, Stress) {
+	const int threads = 8;
+	const int rounds = 2000;
+	concurrent_bi_ring<int, int> ring;
+	std::atomic<bool> done(false);
+	std::vector<std::thread> workers;
+	//each writer grows and trims its own stretch, readers search across all of them
+	loop_up(0, threads) {
+		workers.emplace_back([&ring, i] {
+			concurrent_bi_ring<int, int>::iterator anchor = ring.push(i, 0);
+			for(int j = 0; j < rounds; j++) {
+				concurrent_bi_ring<int, int>::iterator added = ring.insert_after(i, j, anchor);
+				ring.update(anchor, [](int& info) { info++; });
+				if(j % 2) {
+					ring.remove(added);
+				}
+				if(j % 64 == 0) {
+					ring.push(threads + i, j);
+				}
+			}
+		});
+	}
+	std::thread reader([&] {
+		while(!done) {
+			ring.count(0);
+			ring.find(threads - 1, 2);
+			ring.for_each([](const int&, int&) {});
+		}
+	});
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+	done = true;
+	reader.join();
+	EXPECT_EQ(ring.size(), threads * (1u + rounds / 2 + (rounds + 63) / 64));
+	loop_up(0, threads) {
+		EXPECT_EQ(ring.count(i), 1u + rounds / 2);
+		EXPECT_EQ(ring.get_info(i), rounds);
+		EXPECT_EQ(ring.count(threads + i), (rounds + 63u) / 64);
+	}
+	unsigned int seen = 0;
+	ring.for_each([&](const int&, int&) {
+		seen++;
+	});
+	EXPECT_EQ(seen, ring.size());
+}
+
+TEST(ConcurrentTests, QueueOrder) {
+	ring_queue<int, std::string> queue;
+	int key = 0;
+	std::string info;
+	EXPECT_FALSE(queue.pop_front(key, info));
+	loop_up(0, 5) {
+		queue.push(i, std::to_string(i * i));
+	}
+	EXPECT_EQ(queue.size(), 5u);
+	loop_up(0, 3) {
+		EXPECT_TRUE(queue.pop_front(key, info));
+		EXPECT_EQ(key, i);
+		EXPECT_EQ(info, std::to_string(i * i));
+	}
+	queue.push(5, "x");
+	EXPECT_TRUE(queue.pop_front(key, info));
+	EXPECT_EQ(key, 3);
+	EXPECT_EQ(queue.size(), 2u);
+	//the rest is released with the queue
+}
+
+TEST(ConcurrentTests, QueueProducersConsumers) {
+	const int producers = 4;
+	const int consumers = 4;
+	const int each = 20000;
+	ring_queue<int, int> queue;
+	std::atomic<int> taken(0);
+	std::atomic<long long> sum(0);
+	std::atomic<bool> ordered(true);
+	std::vector<std::thread> workers;
+	loop_up(0, producers) {
+		workers.emplace_back([&queue, i] {
+			for(int j = 0; j < each; j++) {
+				queue.push(i, j);
+			}
+		});
+	}
+	loop_up(0, consumers) {
+		workers.emplace_back([&] {
+			//one producer's elements arrive in the order it pushed them
+			std::vector<int> last(producers, -1);
+			int key = 0;
+			int info = 0;
+			while(taken < producers * each) {
+				if(queue.pop_front(key, info)) {
+					if(info <= last[key]) {
+						ordered = false;
+					}
+					last[key] = info;
+					sum += info;
+					taken++;
+				}
+			}
+		});
+	}
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+	EXPECT_TRUE(ordered);
+	EXPECT_TRUE(queue.empty());
+	EXPECT_EQ(sum, producers * (each - 1LL) * each / 2);
+}
+
+TEST(ConcurrentTests, SnapshotSingleThread) {
+	snapshot_bi_ring<int, std::string> ring;
+	EXPECT_TRUE(ring.empty());
+	EXPECT_FALSE(ring.remove(1));
+	EXPECT_FALSE(ring.purge());
+	loop_up(0, 4) {
+		ring.push(i % 2, std::to_string(i));
+	}
+	EXPECT_EQ(ring.size(), 4u);
+	EXPECT_EQ(ring.count(1), 2u);
+	EXPECT_EQ(ring.get_info(1, 2), "3");
+	EXPECT_THROW(ring.get_info(2), std::invalid_argument);
+	{
+		//the view taken first keeps the replaced and removed elements
+		snapshot_bi_ring<int, std::string>::read_guard guard = ring.read();
+		snapshot_bi_ring<int, std::string>::const_iterator itr = ring.begin();
+		EXPECT_TRUE(ring.update(0, "x"));
+		EXPECT_TRUE(ring.remove(1));
+		EXPECT_EQ(*itr, "0");
+		std::string seen;
+		for(; itr != ring.end(); ++itr) {
+			seen += *itr;
+		}
+		EXPECT_EQ(seen, "0123");
+		EXPECT_FALSE(itr.valid());
+		EXPECT_THROW(itr.key(), std::domain_error);
+	}
+	ring.synchronize();
+	EXPECT_EQ(ring.get_info(0), "x");
+	EXPECT_EQ(ring.count(1), 1u);
+	EXPECT_TRUE(ring.purge());
+	EXPECT_EQ(ring.size(), 0u);
+	EXPECT_EQ(ring.count(0), 0u);
+}
+
+TEST(ConcurrentTests, SnapshotReaders) {
+	const int readers = 4;
+	const int rounds = 5000;
+	snapshot_bi_ring<int, int> ring;
+	loop_up(0, 16) {
+		ring.push(i, i);
+	}
+	std::atomic<bool> done(false);
+	std::atomic<bool> consistent(true);
+	std::vector<std::thread> workers;
+	//keys below 16 stay put for good, so every view holds each of them once
+	loop_up(0, readers) {
+		workers.emplace_back([&] {
+			while(!done) {
+				snapshot_bi_ring<int, int>::read_guard guard = ring.read();
+				std::vector<int> stable(16, 0);
+				for(snapshot_bi_ring<int, int>::const_iterator itr = ring.begin(); itr != ring.end(); ++itr) {
+					if(itr.key() < 16) {
+						stable[itr.key()]++;
+						if(*itr != itr.key()) {
+							consistent = false;
+						}
+					}
+				}
+				if(std::count(stable.begin(), stable.end(), 1) != 16) {
+					consistent = false;
+				}
+			}
+		});
+	}
+	for(int j = 0; j < rounds; j++) {
+		ring.push(16 + j % 8, j);
+		ring.update(16 + j % 8, -j);
+		if(j % 3) {
+			ring.remove(16 + j % 8);
+		}
+		if(j % 1000 == 999) {
+			ring.synchronize();
+		}
+	}
+	done = true;
+	for(std::thread& worker : workers) {
+		worker.join();
+	}
+	ring.synchronize();
+	EXPECT_TRUE(consistent);
+	EXPECT_EQ(ring.size(), 16u + (rounds + 2) / 3);
+	loop_up(0, 16) {
+		EXPECT_EQ(ring.get_info(i), i);
+	}
+}
+
+TYPED_TEST(RingTests, Empty) {
+	EXPECT_EQ(this -> t0 -> empty(), true);
+	EXPECT_EQ(this -> t1 -> empty(), false);
+}
+
+TYPED_TEST(RingTests, Size) {
+	EXPECT_EQ(this -> t0 -> size(), 0);
+	EXPECT_EQ(this -> t1 -> size(), 10);
+	EXPECT_EQ(this -> t2 -> size(), 11);
+}
+
+TYPED_TEST(RingTests, Print) {
 	testing::internal::CaptureStdout();
-	t1 -> print();
-	t0 -> print();
+	this -> t1 -> print();
+	this -> t0 -> print();
 	std::string output = testing::internal::GetCapturedStdout();
 	EXPECT_EQ(output, 
 	"Key 0: 1\nKey 1: 2\nKey 2: 3\nKey 3: 4\nKey 4: 5\nKey 5: 6"\
 	"\nKey 6: 7\nKey 7: 8\nKey 8: 9\nKey 9: 10\nRing empty!\n");
 }
 
-TEST_F(RingTests, GetInfo) {
+TYPED_TEST(RingTests, GetInfo) {
 	//try with non-existent element
 	EXPECT_THROW({
-		t0 -> get_info(0);
+		this -> t0 -> get_info(0);
 	}, std::invalid_argument);
 	//try with existing elements
-	EXPECT_EQ(t1 -> get_info(9), 10);
-	EXPECT_EQ(t2 -> get_info(7), 8);
+	EXPECT_EQ(this -> t1 -> get_info(9), 10);
+	EXPECT_EQ(this -> t2 -> get_info(7), 8);
+}
+
+TYPED_TEST(RingTests, Find) {
+	EXPECT_FALSE(this -> t0 -> find(0).valid());
+	EXPECT_EQ(this -> t1 -> find(4).info(), 5);
+	EXPECT_EQ(this -> t2 -> find(2, 2).info(), 5);
+	EXPECT_FALSE(this -> t2 -> find(2, 3).valid());
+	EXPECT_THROW({
+		this -> t1 -> find(4, 0);
+	}, std::invalid_argument);
+	//iterator from a mutable ring writes through
+	*(this -> t1 -> find(3)) = 30;
+	EXPECT_EQ(this -> t1 -> get_info(3), 30);
 }
 
-TEST_F(RingTests, BeginEnd) {
+TYPED_TEST(RingTests, Count) {
+	EXPECT_EQ(this -> t0 -> count(0), 0);
+	EXPECT_EQ(this -> t1 -> count(3), 1);
+	EXPECT_EQ(this -> t2 -> count(2), 2);
+	EXPECT_EQ(this -> t2 -> count(42), 0);
+}
+
+TYPED_TEST(RingTests, BeginEnd) {
 	//use a range based loop to test
 	std::stringstream str;
-	for(int info : *t1) {
+	for(int info : *this -> t1) {
 		str << info;
 	}
 	//see if output matches
 	std::string output = str.str();
-	EXPECT_EQ(output, "123456789");
+	EXPECT_EQ(output, "12345678910");
+}
+
+TYPED_TEST(RingTests, StandardAlgorithms) {
+	using const_iterator = typename TypeParam::const_iterator;
+	static_assert(std::is_same<typename std::iterator_traits<const_iterator>::iterator_category,
+				   std::bidirectional_iterator_tag>::value, "bidirectional");
+	static_assert(std::is_same<typename std::iterator_traits<typename TypeParam::iterator>::reference,
+				   int&>::value, "mutable reference");
+	const TypeParam& ring = *this -> t1;
+	EXPECT_EQ(std::distance(ring.begin(), ring.end()), 10);
+	EXPECT_EQ(std::accumulate(ring.begin(), ring.end(), 0), 55);
+	const_iterator found = std::find_if(ring.begin(), ring.end(), [](int info) { return info > 4; });
+	EXPECT_EQ(found.key(), 4);
+	EXPECT_TRUE(std::find(ring.begin(), ring.end(), 42) == ring.end());
+	//end is one past the last element, both ways
+	EXPECT_EQ(std::prev(ring.end()).key(), 9);
+	std::vector<int> backward(std::make_reverse_iterator(ring.end()),
+				  std::make_reverse_iterator(ring.begin()));
+	EXPECT_EQ(backward, std::vector<int>({10, 9, 8, 7, 6, 5, 4, 3, 2, 1}));
+	//walking on past end keeps going around
+	const_iterator lapped = ring.end();
+	EXPECT_EQ((++lapped).key(), 1);
+	//mutable iterators work with writing algorithms
+	typename TypeParam::iterator first(this -> t2 -> begin());
+	typename TypeParam::iterator last(this -> t2 -> end());
+	std::fill(first, last, 7);
+	EXPECT_EQ(std::count(this -> t2 -> begin(), this -> t2 -> end(), 7), 11);
+	//removing the last element gives back end
+	typename TypeParam::iterator tail(std::prev(this -> t2 -> end()));
+	EXPECT_TRUE(this -> t2 -> remove(tail) == this -> t2 -> end());
+	EXPECT_TRUE(this -> t0 -> begin() == this -> t0 -> end());
 }
 
-TEST_F(RingTests, ClearInfo) {
+TYPED_TEST(RingTests, ClearInfo) {
 	//check if every element got replaced
-	t1 -> clear_info(0);
+	this -> t1 -> clear_info(0);
 	do{
-		EXPECT_EQ(**itr_v, 0);
-	} while(*itr_v != t1 -> begin());
+		EXPECT_EQ(**this -> itr_v, 0);
+	} while(*this -> itr_v != this -> t1 -> begin());
 }
 
-TEST_F(RingTests, Swap) {
-	bi_ring<int, int>::iterator empty;
-	EXPECT_FALSE(t1 -> swap(*itr_v, empty));
-	bi_ring<int, int>::iterator itr(*itr_v);
+TYPED_TEST(RingTests, Swap) {
+	typename TypeParam::iterator empty;
+	EXPECT_FALSE(this -> t1 -> swap(*this -> itr_v, empty));
+	typename TypeParam::iterator itr(*this -> itr_v);
 	itr++;
-	EXPECT_TRUE(t1 -> swap(*itr_v, itr));	
+	EXPECT_TRUE(this -> t1 -> swap(*this -> itr_v, itr));	
 	std::stringstream str;
-	str << *t1;
+	str << *this -> t1;
 	std::string output = str.str();
 	EXPECT_EQ(output, 
 	"[1] 2\n[0] 1\n[2] 3\n[3] 4\n[4] 5\n[5] 6\n[6] 7\n[7] 8\n[8] 9\n[9] 10\n");
 }
 
-TEST_F(RingTests, ConstIteratorDefaultConstructor) {
+TYPED_TEST(RingTests, SwapRings) {
+	TypeParam first(*this -> t1);
+	TypeParam secnd(*this -> t2);
+	//found through argument dependent lookup
+	using std::swap;
+	swap(first, secnd);
+	EXPECT_EQ(first, *this -> t2);
+	EXPECT_EQ(secnd, *this -> t1);
+	//iterators made before a swap walk to the end of the ring now holding their elements
+	typename TypeParam::const_iterator itr = secnd.begin();
+	swap(first, secnd);
+	EXPECT_EQ(itr.key(), 0);
+	EXPECT_EQ(std::distance(itr, first.end()), static_cast<std::ptrdiff_t>(this -> t1 -> size()));
+	swap(first, secnd);
+	first.swap(*this -> t0);
+	EXPECT_TRUE(first.empty());
+	EXPECT_EQ(*this -> t0, *this -> t2);
+	first.push(1, 1);
+	EXPECT_EQ(first.size(), 1);
+}
+
+TYPED_TEST(RingTests, ConstIteratorDefaultConstructor) {
 	//try dereferencing invalid iterator to nothing
-	bi_ring<int, int>::const_iterator itr;
+	typename TypeParam::const_iterator itr;
 	EXPECT_THROW({
 		*itr;
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, ConstIteratorCopyConstructor) {
+TYPED_TEST(RingTests, ConstIteratorCopyConstructor) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr(*itr_v);
+	typename TypeParam::const_iterator itr(*this -> itr_v);
 	EXPECT_EQ(itr.key(), 0);
 }
 
-TEST_F(RingTests, ConstIteratorInitConstructorRing) {
+TYPED_TEST(RingTests, ConstIteratorInitConstructorRing) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr(*t1);
+	typename TypeParam::const_iterator itr(*this -> t1);
 	EXPECT_EQ(itr.key(), 0);
 }
 
-TEST_F(RingTests, ConstIteratorInitConstructorKey) {
+TYPED_TEST(RingTests, ConstIteratorInitConstructorKey) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr(*t1, 5);
+	typename TypeParam::const_iterator itr(*this -> t1, 5);
 	EXPECT_EQ(itr.key(), 5);
 }
 
-TEST_F(RingTests, ConstIteratorAssignmentOperator) {
+TYPED_TEST(RingTests, ConstIteratorAssignmentOperator) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr;
-	itr = (*itr_v);
+	typename TypeParam::const_iterator itr;
+	itr = (*this -> itr_v);
 	EXPECT_EQ(itr.key(), 0);
 }
 
-TEST_F(RingTests, ConstIteratorIncrement) {
+TYPED_TEST(RingTests, ConstIteratorIncrement) {
 	//compare the workings of operators
-	EXPECT_EQ(*itr_v, ++(*itr_v));
-	EXPECT_NE(*itr_v, (*itr_v)++);
-	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	EXPECT_EQ(*this -> itr_v, ++(*this -> itr_v));
+	EXPECT_NE(*this -> itr_v, (*this -> itr_v)++);
+	//check exception, the tests build with the checked policy
+	static_assert(iterator_checks::enabled, "Tests expect checked iterators.");
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
 		empty++;
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, ConstIteratorDecrement) {
+TYPED_TEST(RingTests, ConstIteratorDecrement) {
 	//compare the workings of operators
-	EXPECT_EQ(*itr_v, --(*itr_v));
-	EXPECT_NE(*itr_v, (*itr_v)--);
+	EXPECT_EQ(*this -> itr_v, --(*this -> itr_v));
+	EXPECT_NE(*this -> itr_v, (*this -> itr_v)--);
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
 		empty--;
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, ConstIteratorDereference) {
+TYPED_TEST(RingTests, ConstIteratorDereference) {
 	int keyProto = 0;
-	while(*itr_v != t1 -> begin()) {
-		EXPECT_EQ(**itr_v, keyProto);
+	while(*this -> itr_v != this -> t1 -> begin()) {
+		EXPECT_EQ(**this -> itr_v, keyProto);
 		keyProto++;
-		(*itr_v)--;
+		(*this -> itr_v)--;
 	}
 	//check exception
-	bi_ring<int, int>::const_iterator empty;
+	typename TypeParam::const_iterator empty;
 	EXPECT_THROW({
 		*empty;
 	}, std::domain_error);
 }
 
-TEST_F(RingTests, ConstIteratorEqualityOperator) {
+TYPED_TEST(RingTests, ConstIteratorEqualityOperator) {
 	//build a copy iterator to compare
-	bi_ring<int, int>::const_iterator itr(*itr_v);
-	EXPECT_EQ(itr == *itr_v, true);
-	EXPECT_EQ(itr == *itr_e, false);
+	typename TypeParam::const_iterator itr(*this -> itr_v);
+	EXPECT_EQ(itr == *this -> itr_v, true);
+	EXPECT_EQ(itr == *this -> itr_e, false);
 }
 
-TEST_F(RingTests, ConstIteratorInequalityOperator) {
+TYPED_TEST(RingTests, ConstIteratorInequalityOperator) {
 	//build a copy iterator to compare
-	bi_ring<int, int>::const_iterator itr(*itr_v);
-	EXPECT_EQ(itr != *itr_v, false);
-	EXPECT_EQ(itr != *itr_e, true);
+	typename TypeParam::const_iterator itr(*this -> itr_v);
+	EXPECT_EQ(itr != *this -> itr_v, false);
+	EXPECT_EQ(itr != *this -> itr_e, true);
 }
 
-TEST_F(RingTests, ConstIteratorKeyGetter) {
+TYPED_TEST(RingTests, ConstIteratorKeyGetter) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr(*t1, 5);
+	typename TypeParam::const_iterator itr(*this -> t1, 5);
 	EXPECT_EQ(itr.key(), 5);
 }
 
-TEST_F(RingTests, ConstIteratorInfoGetter) {
+TYPED_TEST(RingTests, ConstIteratorInfoGetter) {
 	//build an initialised iterator
-	bi_ring<int, int>::const_iterator itr(*t1, 5);
+	typename TypeParam::const_iterator itr(*this -> t1, 5);
 	EXPECT_EQ(itr.info(), 6);
 }
 
-TEST_F(RingTests, ConstIteratorValid) {
-	bi_ring<int, int>::const_iterator empty;
+TYPED_TEST(RingTests, ConstIteratorValid) {
+	typename TypeParam::const_iterator empty;
 	//compare initialised against new
 	EXPECT_EQ(empty.valid(), false);
-	EXPECT_EQ(itr_v -> valid(), true);
+	EXPECT_EQ(this -> itr_v -> valid(), true);
 }
 
-TEST_F(RingTests, IteratorCastConstructor) {
-	bi_ring<int, int>::iterator itr(*itr_v);
+TYPED_TEST(RingTests, IteratorCastConstructor) {
+	typename TypeParam::iterator itr(*this -> itr_v);
 	//compare initialised against source
 	EXPECT_EQ(itr.key(), 0);
 }
 
-TEST_F(RingTests, IteratorDereferenceOperator) {
-	bi_ring<int, int>::iterator itr;
+TYPED_TEST(RingTests, IteratorDereferenceOperator) {
+	typename TypeParam::iterator itr;
 	EXPECT_THROW({
 		*itr;
 	}, std::domain_error);
-	itr = t1 -> begin();
+	itr = this -> t1 -> begin();
 	//compare initialised against source
 	EXPECT_EQ(*itr, 1);
 }
 
-TEST_F(RingTests, IteratorKeyAccessor) {
+TYPED_TEST(RingTests, IteratorKeyAccessor) {
 	//build an initialised iterator
-	bi_ring<int, int>::iterator itr(*t1, 5);
+	typename TypeParam::iterator itr(*this -> t1, 5);
 	EXPECT_EQ(itr.key(), 5);
 	itr.key() = 10;
 	EXPECT_EQ(itr.key(), 10);
 }
 
-TEST_F(RingTests, IteratorInfoAccessor) {
+TYPED_TEST(RingTests, IteratorInfoAccessor) {
 	//build an initialised iterator
-	bi_ring<int, int>::iterator itr(*t1, 5);
+	typename TypeParam::iterator itr(*this -> t1, 5);
 	EXPECT_EQ(itr.info(), 6);
 	itr.info() = 20;
 	EXPECT_EQ(itr.info(), 20);
 }
 
-TEST_F(RingTests, Shuffle) {
+TYPED_TEST(RingTests, Shuffle) {
 	//test exceptions first
-	bi_ring<int, int> result;
+	TypeParam result;
 	try {
-		result = shuffle<int, int>(*t1, 0, *t2, 5, 2);
+		result = shuffle<int, int>(*this -> t1, 0, *this -> t2, 5, 2);
 	}
 	catch(const std::exception& e) {
 		EXPECT_TRUE(true);
 	}
-	result = shuffle<int, int>(*t1, 2, *t2, 3, 3);
+	result = shuffle<int, int>(*this -> t1, 2, *this -> t2, 3, 3);
 	std::stringstream str;
 	str << result;
 	std::string output = str.str();
@@ -472,6 +1905,52 @@ TEST_F(RingTests, Shuffle) {
 	"[3] 4\n[4] 5\n[5] 6\n[4] 5\n[5] 6\n[6] 7\n[7] 8\n[8] 9\n");
 }
 
+TYPED_TEST(RingTests, Interleave) {
+	const TypeParam& first = *this -> t1;
+	const TypeParam& secnd = *this -> t2;
+	EXPECT_THROW(interleave(first, 0, secnd, 5, 2), std::invalid_argument);
+	EXPECT_THROW(interleave(first, 2, std::as_const(*this -> t0), 3, 1), std::invalid_argument);
+	//reps past the ring sizes wrap around like shuffle does
+	auto view = interleave(first, 2, secnd, 3, 7);
+	TypeParam expected = shuffle<int, int>(first, 2, secnd, 3, 7);
+	EXPECT_EQ(view.size(), expected.size());
+	std::stringstream streamed;
+	std::stringstream built;
+	for(auto itr = view.begin(); itr != view.end(); ++itr) {
+		streamed << "[" << itr.key() << "] " << *itr << "\n";
+	}
+	built << expected;
+	EXPECT_EQ(streamed.str(), built.str());
+	//walking back visits the same elements
+	std::vector<int> forward(view.begin(), view.end());
+	std::vector<int> backward(std::make_reverse_iterator(view.end()),
+				  std::make_reverse_iterator(view.begin()));
+	std::reverse(backward.begin(), backward.end());
+	EXPECT_EQ(forward, backward);
+	EXPECT_TRUE(view.materialize() == expected);
+	//any number of rings
+	interleave_view<const TypeParam, 3> triple({&first, &secnd, &first}, {1, 2, 3}, 2);
+	EXPECT_EQ(keys_of(triple.materialize()), "0 0 9 0 1 2 1 2 3 3 4 5 ");
+}
+
+TYPED_TEST(RingTests, InterleaveMove) {
+	TypeParam first(*this -> t1);
+	TypeParam secnd(*this -> t2);
+	EXPECT_THROW(interleave(first, 1, first, 1, 1).materialize_move(), std::invalid_argument);
+	//elements read once are taken, the rest of the ring stays
+	TypeParam moved = interleave(first, 2, secnd, 3, 3).materialize_move();
+	EXPECT_TRUE(moved == (shuffle<int, int>(*this -> t1, 2, *this -> t2, 3, 3)));
+	EXPECT_EQ(keys_of(first), "6 7 8 9 ");
+	EXPECT_EQ(keys_of(secnd), "1 2 ");
+	//repeated reads copy until the last one
+	first = *this -> t1;
+	secnd = *this -> t2;
+	moved = interleave(first, 2, secnd, 3, 7).materialize_move();
+	EXPECT_TRUE(moved == (shuffle<int, int>(*this -> t1, 2, *this -> t2, 3, 7)));
+	EXPECT_TRUE(first.empty());
+	EXPECT_TRUE(secnd.empty());
+}
+
 int main (int argc, char** argv)
 {
 	::testing::InitGoogleTest(&argc, argv);